@@ -33,11 +33,13 @@
 
 #include "DGtal/io/Display3D.h"
 #include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/writers/SurfelMeshWriter.h"
 #include "DGtal/io/colormaps/GradientColorMap.h"
 #include "DGtal/io/Color.h"
 
 #include "DGtal/topology/KhalimskySpaceND.h"
 #include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/base/ProfilerAllocations.h"
 
 #include "ImaGene/Arguments.h"
 
@@ -53,7 +55,7 @@ static ImaGene::Arguments args;
 int main( int argc, char** argv )
 {
   args.addOption("-image", "-image <filename>  ", "aFile.vol ");
-  args.addOption("-output", "-output <filename> the output filename with .off extension", "output.off"); 
+  args.addOption("-output", "-output <filename> the output filename with .off extension, or .ply for a binary PLY mesh", "output.off"); 
   args.addOption("-exportSRC", "-exportSRC <filename> export the source set of voxels", "src.off"); 
   args.addOption("-threshold", "-threshold <min> <max> (default: min = 128, max 255  ", "128", "255");
   args.addOption( "-badj", "-badj <0/1>: 0 is interior bel adjacency, 1 is exterior (def. is 0).", "0" );
@@ -78,7 +80,9 @@ int main( int argc, char** argv )
   
   typedef ImageSelector < Domain, int>::Type Image;
   typedef IntervalThresholder<Image::Value> Binarizer; 
+  ProfileZone readZone("importVol");
   Image image =   VolReader<Image>::importVol(imageFileName);
+  readZone.end();
 
   Binarizer b(minThreshold, maxThreshold); 
   PointFunctorPredicate<Image,Binarizer> predicate(image, b); 
@@ -92,15 +96,18 @@ int main( int argc, char** argv )
   K.init(pLower, pUpper, true);
  
   SurfelAdjacency<3> sAdj(  badj );
-  vector<vector<SCell> > vectConnectedSCell;
- 
- 
-  Surfaces<KSpace>::extractAllConnectedSCell(vectConnectedSCell,K, sAdj, predicate, false);
 
-  Display3D exportSurfel;
- 
+  // Each connected component is streamed to the mesh as soon as it is
+  // tracked: its pointels are shared with the other faces and its
+  // surfels are not kept.
+  SurfelMeshWriter<KSpace> exportSurfel(K);
+  ProfileZone extractZone("extractAllConnectedSCell");
+  Surfaces<KSpace>::extractAllConnectedSCell(exportSurfel.inserter(), K, sAdj, predicate, false);
+  extractZone.end();
+  trace.info() << exportSurfel << endl;
+
   // Each connected compoments are simply displayed with a specific color.
-  GradientColorMap<long> gradient(0, (const long)vectConnectedSCell.size());
+  GradientColorMap<long> gradient(0, (const long)exportSurfel.nbComponents());
   gradient.addColor(Color::Red);
   gradient.addColor(Color::Yellow);
   gradient.addColor(Color::Green);
@@ -108,32 +115,25 @@ int main( int argc, char** argv )
   gradient.addColor(Color::Blue);
   gradient.addColor(Color::Magenta);
   gradient.addColor(Color::Red);  
- 
-  // Processing ViewerInt  
-  for(int i=0; i< vectConnectedSCell.size();i++){
-    DGtal::Color col= gradient(i);
-    exportSurfel << CustomColors3D(Color(250, 0,0), Color(col.red(), 
-							  col.green(),
-							  col.blue()));
-    for(int j=0; j< vectConnectedSCell.at(i).size();j++){
-      exportSurfel << vectConnectedSCell.at(i).at(j);
-    }    
-  }
 
-  Z3i::DigitalSet imageSet(image.domain());
-  SetFromImage<Z3i::DigitalSet>::append<Image>(imageSet, image, minThreshold, maxThreshold);
-  
-  
-  exportSurfel << CustomColors3D(Color(250, 0,0),Color(250, 200,200, 200));
-  //exportSurfel << imageSet;  
-  exportSurfel >> outputFileName;
+  ProfileZone exportZone("exportMesh");
+  bool exported = exportSurfel.exportMesh(outputFileName, gradient);
+  exportZone.end();
+  if(!exported){
+    trace.error() << "Problem in the export of " << outputFileName << endl;
+    return 1;
+  }
 
   if(args.check("-exportSRC")){
+    ProfileZone zone("exportSRC");
+    // the source set is the whole thresholded volume: one bit per voxel
+    Z3i::BitGridDigitalSet imageSet(image.domain());
+    SetFromImage<Z3i::BitGridDigitalSet>::append<Image>(imageSet, image, minThreshold, maxThreshold);
     Display3D exportSRC;
     exportSRC << imageSet;
     exportSRC >> srcFileName;
   }
-
+  return 0;
 }
 
 
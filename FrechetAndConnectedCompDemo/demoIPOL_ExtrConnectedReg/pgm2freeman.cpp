@@ -27,12 +27,15 @@
 
 #include "DGtal/io/colormaps/GrayscaleColorMap.h"
 #include "DGtal/io/readers/PNMReader.h"
+#include "DGtal/io/writers/BinaryContourWriter.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/images/ImageSelector.h"
+#include "DGtal/images/ImageHistogram.h"
 
 #include "DGtal/geometry/curves/FreemanChain.h"
 #include "DGtal/geometry/helpers/ContourHelper.h"
 #include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/base/ProfilerAllocations.h"
 
 #include <vector>
 #include <string>
@@ -47,57 +50,39 @@ static const std::string PROG_VERSION=" 1.2 (17-04-2014)";
 
 typedef ImageSelector < Z2i::Domain, unsigned char>::Type Image;
 
-
-
-std::vector<unsigned int> getHistoFromImage(const Image &image){
-  const Image::Domain &imgDom = image.domain();
-  std::vector<unsigned int> vectHisto(UCHAR_MAX);
-  for(Image::Domain::ConstIterator it=imgDom.begin(); it!= imgDom.end(); ++it){
-    vectHisto[image(*it)]++;
-  }
-  return vectHisto;
-}
+// with -binary, the contours are gathered and written at the end.
+static bool binaryOutput = false;
+static std::vector< std::vector< Z2i::Point > > binaryContours;
 
 
 
+/**
+ * The level of a pixel for a range of thresholds: the first i such
+ * that its value is in the interval [min, min+((i+1)*increment)], or
+ * the number of intervals if there is none.
+ */
+struct ThresholdRangeLevel {
+  typedef Z2i::Point Point;
+  typedef IntervalThresholder<Image::Value> Binarizer; 
 
-unsigned int 
-getOtsuThreshold(const Image &image){
-  std::vector<unsigned int> histo = getHistoFromImage(image);
-  unsigned int imageSize = image.domain().size();
-  unsigned int sumA = 0;
-  unsigned int sumB = imageSize;
-  unsigned int muA=0;
-  unsigned int muB=0;
-  unsigned int sumMuAll= 0;
-  for( unsigned int t=0; t< histo.size();t++){
-    sumMuAll+=histo[t]*t;
-  }
-  
-  unsigned int thresholdRes=0;
-  double valMax=0.0;
-  for( unsigned int t=0; t< histo.size(); t++){
-    sumA+=histo[t];
-    if(sumA==0)
-      continue; 
-    sumB=imageSize-sumA;
-    if(sumB==0){
-      break;
-    }
-    
-    muA+=histo[t]*t;
-    muB=sumMuAll-muA;
-    double muAr=muA/(double)sumA;
-    double muBr=muB/(double)sumB;
-    double sigma=  (double)sumA*(double)sumB*(muAr-muBr)*(muAr-muBr);
-    if(valMax<=sigma){
-      valMax=sigma;
-      thresholdRes=t;
+  ThresholdRangeLevel(const Image &image, int min, int increment, unsigned int nbLevels)
+    : myImage(&image), myLevelOfValue(UCHAR_MAX+1, nbLevels){
+    for(unsigned int v=0; v<=UCHAR_MAX; v++){
+      for(unsigned int i=0; i<nbLevels; i++){
+	Binarizer b(min, min+(i+1)*increment);
+	if(b(v)){
+	  myLevelOfValue[v]=i;
+	  break;
+	}
+      }
     }
   }
-  return thresholdRes;
-}
-
+  unsigned int operator()(const Point &p) const {
+    return myLevelOfValue[(*myImage)(p)];
+  }
+  const Image *myImage;
+  std::vector<unsigned int> myLevelOfValue;
+};
 
 
 
@@ -109,6 +94,10 @@ struct compContours {
 void saveAllContoursAsFc(std::vector< std::vector< Z2i::Point >  >  vectContoursBdryPointels, unsigned int minSize){
   for(unsigned int k=0; k<vectContoursBdryPointels.size(); k++){
     if(vectContoursBdryPointels.at(k).size()>minSize){
+      if(binaryOutput){
+	binaryContours.push_back(vectContoursBdryPointels.at(k));
+	continue;
+      }
       FreemanChain<Z2i::Integer> fc (vectContoursBdryPointels.at(k));    
       std::cout << fc.x0 << " " << fc.y0   << " " << fc.chain << std::endl; 
 	  
@@ -125,6 +114,10 @@ void saveLargestContourAsSDP(std::vector< std::vector< Z2i::Point >  >  vectCont
     }
   }
   std::sort (vectContoursToSort.begin(), vectContoursToSort.end(), myCompContour);
+  if(binaryOutput){
+    binaryContours.push_back(vectContoursToSort.at(0));
+    return;
+  }
   for(unsigned int i=0; i<vectContoursToSort.at(0).size(); i++){
     std::cout << vectContoursToSort.at(0).at(i)[0] << " " <<  vectContoursToSort.at(0).at(i)[1] << std::endl; 
   }
@@ -140,6 +133,10 @@ void saveAllContourAsSDP(std::vector< std::vector< Z2i::Point >  >  vectContours
     }
   }
   std::sort (vectContoursToSort.begin(), vectContoursToSort.end(), myCompContour);  
+  if(binaryOutput){
+    binaryContours.insert(binaryContours.end(), vectContoursToSort.begin(), vectContoursToSort.end());
+    return;
+  }
   for( int j=0; j < vectContoursToSort.size(); j++){
     for(unsigned int i=0; i<vectContoursToSort.at(j).size(); i++){
       std::cout << vectContoursToSort.at(j).at(i)[0] << " " <<  vectContoursToSort.at(j).at(i)[1] << " "; 
@@ -157,6 +154,10 @@ void saveSelContoursAsFC(std::vector< std::vector< Z2i::Point >  >  vectContours
       unsigned int distance = (unsigned int)ceil(sqrt((double)(ptMean[0]-refPoint[0])*(ptMean[0]-refPoint[0])+
 						      (ptMean[1]-refPoint[1])*(ptMean[1]-refPoint[1])));
       if(distance<=selectDistanceMax){
+	if(binaryOutput){
+	  binaryContours.push_back(vectContoursBdryPointels.at(k));
+	  continue;
+	}
 	FreemanChain<Z2i::Integer> fc (vectContoursBdryPointels.at(k));    
 	std::cout << fc.x0 << " " << fc.y0   << " " << fc.chain << std::endl; 
       }      
@@ -180,6 +181,10 @@ void saveLargestContourSelContoursAsSDP(std::vector< std::vector< Z2i::Point >
     }    
   }
   std::sort (vectContoursToSort.begin(), vectContoursToSort.end(), myCompContour);
+  if(binaryOutput){
+    binaryContours.push_back(vectContoursToSort.at(0));
+    return;
+  }
   for(unsigned int i=0; i<vectContoursToSort.at(0).size(); i++){
     std::cout << vectContoursToSort.at(0).at(i)[0] << " " <<  vectContoursToSort.at(0).at(i)[1] << std::endl; 
   }
@@ -206,6 +211,7 @@ int main( int argc, char** argv )
   args.addBooleanOption("-invertVerticalAxis", "-invertVerticalAxis used to transform the contour representation (need for DGtal), used o nly for the contour displayed, not for the contour selection (-selectContour). ");
   args.addBooleanOption("-outputSDP", "-outputSDP export as a sequence of discrete points instead of freemanchain (use the largest contour if more contours appears)");
   args.addBooleanOption("-outputSDPAll", "-outputSDPAll export as a sequence of discrete points instead of freemanchain (all contours are exported: one per line)");
+  args.addBooleanOption("-binary", "-binary: write the contours selected by the other options in the binary contour format (see DGtal::BinaryContourFormat) instead of text. The contours of all the thresholds of -thresholdRange are written in the same file.");
   args.addBooleanOption("-version", "-version : display version");    
 
  
@@ -238,6 +244,7 @@ int main( int argc, char** argv )
   bool thresholdRange= args.check("-thresholdRange");
   bool exportSDP=args.check("-outputSDP");
   bool exportSDPALL= args.check("-outputSDPAll");
+  binaryOutput = args.check("-binary");
   
   int min, max, increment;
   if(thresholdRange){
@@ -260,7 +267,9 @@ int main( int argc, char** argv )
   typedef ImageSelector < Z2i::Domain, unsigned char>::Type Image;
   typedef IntervalThresholder<Image::Value> Binarizer; 
   std::string imageFileName = args.getOption("-image")->getValue(0);
+  ProfileZone readZone("importPGM");
   Image image = PNMReader<Image>::importPGM( imageFileName ); 
+  readZone.end();
   
   Z2i::KSpace ks;
   if(! ks.init( image.domain().lowerBound(), 
@@ -274,7 +283,9 @@ int main( int argc, char** argv )
     if (!args.check("-maxThreshold")&& !args.check("-minThreshold")){
       minThreshold=0;
       trace.info() << "Min/Max threshold values not specified, set min to 0 and computing max with the otsu algorithm...";
-      maxThreshold = getOtsuThreshold(image);
+      ImageHistogram::Histogram histo;
+      ImageHistogram::compute(image, histo);
+      maxThreshold = ImageHistogram::otsuThreshold(histo);
       trace.info() << "[done] (max= " << maxThreshold << ") "<< std::endl;
     }
 
@@ -285,8 +296,10 @@ int main( int argc, char** argv )
     
     SurfelAdjacency<2> sAdj( badj );
     std::vector< std::vector< Z2i::Point >  >  vectContoursBdryPointels;
+    ProfileZone extractZone("extractAllPointContours4C");
     Surfaces<Z2i::KSpace>::extractAllPointContours4C( vectContoursBdryPointels,
   						      ks, predicate, sAdj );  
+    extractZone.end();
     if(select){
       if(!exportSDP){
 	saveSelContoursAsFC(vectContoursBdryPointels,  minSize, selectCenter,  selectDistanceMax);
@@ -306,18 +319,24 @@ int main( int argc, char** argv )
     }
     trace.info()<< " [done] " << std::endl;
   }else{
-    for(int i=0; minThreshold+(i+1)*increment< maxThreshold; i++){
+    unsigned int nbLevels=0;
+    while(minThreshold+((int)nbLevels+1)*increment< maxThreshold){
+      nbLevels++;
+    }
+    // all the levels are extracted with a single scan of the image.
+    SurfelAdjacency<2> sAdj( badj );
+    std::vector< std::vector< std::vector< Z2i::Point >  > > vectLevelContours;
+    ProfileZone extractZone("extractAllPointContours4CByLevels");
+    Surfaces<Z2i::KSpace>::extractAllPointContours4CByLevels( vectLevelContours, ks,
+							      ThresholdRangeLevel(image, minThreshold, increment, nbLevels),
+							      nbLevels, sAdj );
+    extractZone.end();
+    for(unsigned int i=0; i<nbLevels; i++){
       min = minThreshold;
       max = minThreshold+(i+1)*increment;
       
-      Binarizer b(min, max); 
-      PointFunctorPredicate<Image,Binarizer> predicate(image, b); 
-      
       trace.info() << "DGtal contour extraction from thresholds ["<<  min << "," << max << "]" ;
-      SurfelAdjacency<2> sAdj( badj );
-      std::vector< std::vector< Z2i::Point >  >  vectContoursBdryPointels;
-      Surfaces<Z2i::KSpace>::extractAllPointContours4C( vectContoursBdryPointels,
-  							ks, predicate, sAdj );  
+      std::vector< std::vector< Z2i::Point >  >  &vectContoursBdryPointels = vectLevelContours.at(i);
       if(select){
   	if(!exportSDP){
 	  saveSelContoursAsFC(vectContoursBdryPointels,  minSize, selectCenter,  selectDistanceMax);
@@ -331,9 +350,13 @@ int main( int argc, char** argv )
 	  saveLargestContourAsSDP(vectContoursBdryPointels,  minSize); 
 	}
       }
+      std::vector< std::vector< Z2i::Point >  >().swap(vectContoursBdryPointels);
       trace.info() << " [done]" << std::endl;
     }
   }
+  if(binaryOutput){
+    BinaryContourWriter<Z2i::Point>::exportContours(std::cout, binaryContours);
+  }
   return 0;
 }
 
@@ -0,0 +1,376 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FrechetSimplification.h
+ *
+ * @date 2026/10/17
+ *
+ * Simplification of contours with the FrechetShortcut, and output of
+ * the results, shared by frechetSimplification and
+ * pgm2frechetSimplification.
+ *
+ * This file is part of the IPOL source demo.
+ */
+
+#if !defined FrechetSimplification_h
+#define FrechetSimplification_h
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <cstdlib>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Profiler.h"
+#include "DGtal/base/Circulator.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/curves/FrechetShortcut.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/FrechetShortcutHierarchy.h"
+#include "DGtal/io/boards/Board2D.h"
+#include "DGtal/io/colormaps/GradientColorMap.h"
+
+
+// The contours are segmented directly in their storage, without
+// going through a GridCurve.
+typedef std::vector<DGtal::Z2i::Point>::const_iterator Iterator;
+typedef DGtal::FrechetShortcut<Iterator,int> SegmentComputer;
+typedef DGtal::GreedySegmentation<SegmentComputer> Segmentation;
+// Closed contours (-closed) are segmented around their circulator.
+typedef DGtal::Circulator<Iterator> Circulator;
+typedef DGtal::FrechetShortcut<Circulator,int> ClosedSegmentComputer;
+typedef DGtal::GreedySegmentation<ClosedSegmentComputer> ClosedSegmentation;
+// Several errors at once (-errors).
+typedef DGtal::FrechetShortcutHierarchy<Iterator,int> Hierarchy;
+typedef DGtal::FrechetShortcutHierarchy<Circulator,int> ClosedHierarchy;
+
+
+
+inline
+void displayContour(const std::vector<DGtal::Z2i::Point> &contour, DGtal::Board2D &aBoard){
+  aBoard.setPenColor(DGtal::Color::Blue);
+  aBoard.setFillColor(DGtal::Color::White);
+  aBoard.setLineStyle (LibBoard::Shape::SolidStyle );
+  aBoard.setLineWidth (2);  
+  std::vector<LibBoard::Point> contourPt;
+  for(unsigned int j=0; j<contour.size(); j++){
+    LibBoard::Point pt((double)(contour.at(j)[0]),
+		       (double)(contour.at(j)[1]));
+    contourPt.push_back(pt);
+  } 
+  aBoard.drawPolyline(contourPt);
+}
+
+
+
+
+
+/**
+ * Result of the simplification of one contour. It is kept until the
+ * contours are written, so that they can be processed in any order.
+ */
+template <typename TSegmentComputer>
+struct SimplifiedContour{
+  /// Segments of the simplification (they refer to the input contour).
+  std::vector<TSegmentComputer> segments;
+  double cpuTime;
+};
+
+
+
+/**
+ * Segments the range [itb,ite) (the whole loop for a circulator with
+ * itb == ite).
+ */
+template <typename TSegmentation>
+inline
+void segmentContour(const typename TSegmentation::ConstIterator &itb,
+		    const typename TSegmentation::ConstIterator &ite, double error, bool flagWidthOnly,
+		    SimplifiedContour<typename TSegmentation::SegmentComputer> &res){
+  typedef typename TSegmentation::SegmentComputer Computer;
+  // wall clock (clock() would count the time of all the threads), also
+  // recorded by DGtal::profiler when it is enabled. The segments are
+  // computed by the iteration, not by the constructor.
+  DGtal::ProfileZone zone("segmentation");
+  TSegmentation theSegmentation( itb, ite, Computer(error,flagWidthOnly) );
+  
+  typename TSegmentation::SegmentComputerIterator it = theSegmentation.begin();
+  typename TSegmentation::SegmentComputerIterator itEnd = theSegmentation.end();
+  
+  for ( ; it != itEnd; ++it) {
+    res.segments.push_back(*it);
+  }
+  res.cpuTime = zone.end();
+}
+
+inline
+void processContour(const std::vector<DGtal::Z2i::Point> &contour, double error,
+		    bool flagWidthOnly, SimplifiedContour<SegmentComputer> &res){ 
+  segmentContour<Segmentation>(contour.begin(), contour.end(), error, flagWidthOnly, res);
+}
+
+inline
+void processContour(const std::vector<DGtal::Z2i::Point> &contour, double error,
+		    bool flagWidthOnly, SimplifiedContour<ClosedSegmentComputer> &res){ 
+  if(contour.empty())
+    return;
+  Circulator c(contour.begin(), contour.begin(), contour.end());
+  segmentContour<ClosedSegmentation>(c, c, error, flagWidthOnly, res);
+}
+
+
+
+/**
+ * Writes the vertices and the statistics of a simplified contour and
+ * draws it.
+ */
+template <typename TSegmentComputer>
+inline
+void writeContour(const std::vector<DGtal::Z2i::Point> &contour, const SimplifiedContour<TSegmentComputer> &res,
+		  DGtal::Board2D & aBoard, double error, std::ofstream &f, bool displayPolygonInline=true){
+  const std::vector<TSegmentComputer> &vectSeg = res.segments;
+  int simplificationSize=0;
+
+  aBoard.setPenColor(DGtal::Color::Red);
+  aBoard.setLineStyle (LibBoard::Shape::SolidStyle );
+  
+  for(unsigned int i=0; i < vectSeg.size(); i++){
+    const TSegmentComputer &s = vectSeg[i];
+    //output vertices of the simplification 
+    if(displayPolygonInline){
+      f << (*(s.begin()))[0] << " " << (*(s.begin()))[1] <<  " " ;
+    }else{
+      f << (*(s.begin()))[0] << " " << (*(s.begin()))[1] <<  std::endl;
+    }
+    
+  // size of the simpification
+    simplificationSize++;
+  }
+  f << std::endl;
+
+  std::cout << contour.size()<<" " << error<<" " << simplificationSize<<" "<< res.cpuTime << std::endl;
+  
+  displayContour(contour, aBoard);
+  
+  for(unsigned int j=0; j < contour.size(); j++){
+    aBoard << DGtal::SetMode(contour[j].className(), "Grid");
+    aBoard << contour[j];
+  }
+  
+  for( int i=0; i < vectSeg.size(); i++){
+    aBoard << DGtal::CustomStyle( vectSeg.at(i).className(),  new DGtal::CustomPen( DGtal::Color::Red, DGtal::Color::Red, 4.0, 
+								      DGtal::Board2D::Shape::SolidStyle,
+								      DGtal::Board2D::Shape::RoundCap,
+								      DGtal::Board2D::Shape::RoundJoin ) );
+    aBoard<< vectSeg.at(i);
+  }
+}
+
+
+
+/**
+ * Simplifies all the contours with segments of type TSegmentComputer,
+ * on nbThreads threads if OpenMP is available, then writes and draws
+ * them in their input order.
+ */
+template <typename TSegmentComputer>
+inline
+void simplifyContours(const std::vector< std::vector<DGtal::Z2i::Point> > &vectContours, DGtal::Board2D & aBoard,
+		      double error, std::ofstream &f, bool flagWidthOnly, int nbThreads,
+		      bool displayPolygonInline){
+  std::vector< SimplifiedContour<TSegmentComputer> > results(vectContours.size());
+  int n = (int) vectContours.size();
+  DGtal::ProfileZone simplifyZone("processContours: simplification");
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(nbThreads)
+#endif
+  for (int j=0; j<n; j++){
+    DGtal::ProfileZone zone("processContour");
+    processContour(vectContours.at(j), error, flagWidthOnly, results[j]);
+  }
+  simplifyZone.end();
+  DGtal::ProfileZone writeZone("processContours: output");
+  for (int j=0; j<n; j++){
+    if(n > 1)
+      DGtal::trace.info() << "# Processing contour " << j << std::endl;
+    writeContour(vectContours.at(j), results[j], aBoard, error, f, displayPolygonInline);
+    results[j].segments.clear();
+  }
+}
+
+
+/**
+ * Simplifies all the contours (as closed curves if closed is 'true':
+ * the last point of each contour must then be adjacent to the first),
+ * then writes and draws them in their input order.
+ */
+inline
+void processContours(const std::vector< std::vector<DGtal::Z2i::Point> > &vectContours, DGtal::Board2D & aBoard,
+		     double error, std::ofstream &f, bool flagWidthOnly, int nbThreads,
+		     bool displayPolygonInline=true, bool closed=false){
+  if(closed)
+    simplifyContours<ClosedSegmentComputer>(vectContours, aBoard, error, f, flagWidthOnly, nbThreads, displayPolygonInline);
+  else
+    simplifyContours<SegmentComputer>(vectContours, aBoard, error, f, flagWidthOnly, nbThreads, displayPolygonInline);
+}
+
+
+/**
+ * @return the errors of a comma separated list such as "1,2,4,8".
+ */
+inline
+std::vector<double> parseErrors(const std::string &list){
+  std::vector<double> errors;
+  std::istringstream in(list);
+  std::string item;
+  while(std::getline(in, item, ','))
+    if(!item.empty())
+      errors.push_back(atof(item.c_str()));
+  return errors;
+}
+
+
+/**
+ * Computes the hierarchy of a contour.
+ */
+inline
+void processContour(const std::vector<DGtal::Z2i::Point> &contour, unsigned int nbChunks, Hierarchy &res){
+  res.init(contour.begin(), contour.end(), nbChunks);
+}
+
+/**
+ * Computes the hierarchy of a closed contour, around its circulator
+ * as processContour for a single error.
+ */
+inline
+void processContour(const std::vector<DGtal::Z2i::Point> &contour, unsigned int nbChunks, ClosedHierarchy &res){
+  if(contour.empty())
+    return;
+  Circulator c(contour.begin(), contour.begin(), contour.end());
+  res.init(c, c, nbChunks);
+}
+
+
+/**
+ * Simplifies all the contours for several errors at once, as nested
+ * levels of type THierarchy, on nbThreads threads if OpenMP is
+ * available. Each contour is written as a progressive polyline: the
+ * vertices of the finest level, each followed by its tolerance, the
+ * largest error for which it is kept (the polyline of an error e is
+ * made of the vertices of tolerance >= e). The levels are drawn from
+ * the finest (red) to the coarsest one (green).
+ */
+template <typename THierarchy>
+inline
+void simplifyContoursByErrors(const std::vector< std::vector<DGtal::Z2i::Point> > &vectContours, DGtal::Board2D & aBoard,
+			      const std::vector<double> &errors, std::ofstream &f, bool flagWidthOnly, int nbThreads,
+			      bool displayPolygonInline, bool closed){
+  typedef typename THierarchy::ConstIterator ConstIterator;
+  int n = (int) vectContours.size();
+  std::vector<THierarchy> results(n, THierarchy(errors, flagWidthOnly));
+  DGtal::ProfileZone simplifyZone("processContoursByErrors: simplification");
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(nbThreads)
+#endif
+  for (int j=0; j<n; j++){
+    DGtal::ProfileZone zone("processContour");
+    // the first level of a single contour is segmented in nbThreads chunks
+    processContour(vectContours[j], nbThreads, results[j]);
+  }
+  simplifyZone.end();
+
+  DGtal::ProfileZone writeZone("processContoursByErrors: output");
+  unsigned int nbLevels = (n > 0) ? results[0].nbLevels() : 0;
+  DGtal::GradientColorMap<int> gradient(0, nbLevels > 1 ? (int) nbLevels - 1 : 1);
+  gradient.addColor(DGtal::Color::Green);
+  gradient.addColor(DGtal::Color::Yellow);
+  gradient.addColor(DGtal::Color::Red);
+  for (int j=0; j<n; j++){
+    if(n > 1)
+      DGtal::trace.info() << "# Processing contour " << j << std::endl;
+    const THierarchy &h = results[j];
+    const std::vector<ConstIterator> &vertices = h.vertices();
+    for(unsigned int i=0; i < vertices.size(); i++){
+      f << (*vertices[i])[0] << " " << (*vertices[i])[1] << " " << h.tolerance(i);
+      f << (displayPolygonInline ? " " : "\n");
+    }
+    f << std::endl;
+
+    displayContour(vectContours[j], aBoard);
+    for(unsigned int i=0; i < vectContours[j].size(); i++){
+      aBoard << DGtal::SetMode(vectContours[j][i].className(), "Grid");
+      aBoard << vectContours[j][i];
+    }
+    for(int k=(int) h.nbLevels()-1; k>=0; k--){
+      std::vector<ConstIterator> level;
+      h.getVertices(k, level);
+      std::cout << vectContours[j].size() << " " << h.error(k) << " " << level.size() << " " << h.time(k) << std::endl;
+      aBoard.setPenColor(gradient(k));
+      aBoard.setLineStyle(LibBoard::Shape::SolidStyle);
+      aBoard.setLineWidth(4.0);
+      // a closed polyline goes back to its first vertex
+      unsigned int nbEdges = level.empty() ? 0 : ((closed && level.size() > 1) ? level.size() : level.size() - 1);
+      for(unsigned int i=0; i < nbEdges; i++){
+	const ConstIterator &next = level[(i+1) % level.size()];
+	aBoard.drawLine((*level[i])[0], (*level[i])[1], (*next)[0], (*next)[1]);
+      }
+    }
+  }
+}
+
+
+/**
+ * Simplifies all the contours for several errors at once (as closed
+ * curves if closed is 'true', see processContours), then writes and
+ * draws them in their input order.
+ */
+inline
+void processContoursByErrors(const std::vector< std::vector<DGtal::Z2i::Point> > &vectContours, DGtal::Board2D & aBoard,
+			     const std::vector<double> &errors, std::ofstream &f, bool flagWidthOnly, int nbThreads,
+			     bool displayPolygonInline=true, bool closed=false){
+  if(errors.empty()){
+    DGtal::trace.error() << "No error given to -errors." << std::endl;
+    return;
+  }
+  if(closed)
+    simplifyContoursByErrors<ClosedHierarchy>(vectContours, aBoard, errors, f, flagWidthOnly, nbThreads, displayPolygonInline, true);
+  else
+    simplifyContoursByErrors<Hierarchy>(vectContours, aBoard, errors, f, flagWidthOnly, nbThreads, displayPolygonInline, false);
+}
+
+
+/**
+ * Draws the board in a PNG image (PPM if the file name ends with
+ * .ppm), with the page of output.eps, cropped to its bounding box as
+ * "gs -dEPSCrop" would render it, but without going through
+ * Postscript.
+ */
+inline
+void saveRaster(const DGtal::Board2D &aBoard, const std::string &fileName,
+		double resolution, bool antialiased, int nbThreads){
+  DGtal::ProfileZone zone("saveRaster");
+  bool ppm = fileName.size() >= 4 && fileName.compare(fileName.size() - 4, 4, ".ppm") == 0;
+  aBoard.saveRaster(fileName.c_str(), ppm ? LibBoard::Board::RasterPPM : LibBoard::Board::RasterPNG,
+		    800, 800, 10.0, resolution, antialiased, nbThreads);
+}
+
+
+#endif // !defined FrechetSimplification_h
@@ -48,9 +48,13 @@
 #include "DGtal/helpers/StdDefs.h"
 
 #include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/io/readers/BinaryContourReader.h"
+#include "DGtal/base/ProfilerAllocations.h"
 
 #include "ImaGene/Arguments.h"
 
+#include "FrechetSimplification.h"
+
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -62,83 +66,6 @@ using namespace Z2i;
 static ImaGene::Arguments args;
 
 
-typedef Curve::PointsRange::ConstIterator Iterator;
-typedef FrechetShortcut<Iterator,int> SegmentComputer;
-typedef GreedySegmentation<SegmentComputer> Segmentation;
-
-
-
-void displayContour(const std::vector<Z2i::Point> &contour, Board2D &aBoard){
-  aBoard.setPenColor(Color::Blue);
-  aBoard.setFillColor(Color::White);
-  aBoard.setLineStyle (LibBoard::Shape::SolidStyle );
-  aBoard.setLineWidth (2);  
-  vector<LibBoard::Point> contourPt;
-  for(unsigned int j=0; j<contour.size(); j++){
-    LibBoard::Point pt((double)(contour.at(j)[0]),
-		       (double)(contour.at(j)[1]));
-    contourPt.push_back(pt);
-  } 
-  aBoard.drawPolyline(contourPt);
-}
-
-
-
-
-
-void processContour(const std::vector<Z2i::Point> &contour, Board2D & aBoard, double error,ofstream &f,
-		    bool flagWidthOnly, bool displayPolygonInline=true){ 
-  Curve aCurve; //grid curve
-  aCurve.initFromVector(contour);
-  typedef Curve::PointsRange Range; //range
-  Range r = aCurve.getPointsRange(); //range
-  clock_t time1, time2;
-  time1 = clock();
-  Segmentation theSegmentation( r.begin(), r.end(), SegmentComputer(error,flagWidthOnly) );
-  time2 = clock();
-  double cpuTime;
-  cpuTime =  ((double)time2-(double)time1)/((double)CLOCKS_PER_SEC/1000);
-  
-  Segmentation::SegmentComputerIterator it = theSegmentation.begin();
-  Segmentation::SegmentComputerIterator itEnd = theSegmentation.end();
-  
-  int simplificationSize=0;
-
-  aBoard.setPenColor(Color::Red);
-  aBoard.setLineStyle (LibBoard::Shape::SolidStyle );
-  
-  std::vector<SegmentComputer> vectSeg;
-  for ( ; it != itEnd; ++it) {
-    SegmentComputer s(*it);
-    vectSeg.push_back(*it);
-    //output vertices of the simplification 
-    if(displayPolygonInline){
-      f << (*(s.begin()))[0] << " " << (*(s.begin()))[1] <<  " " ;
-    }else{
-      f << (*(s.begin()))[0] << " " << (*(s.begin()))[1] <<  endl;
-    }
-    
-  // size of the simpification
-    simplificationSize++;
-  }
-  f << endl;
-
-  std::cout << aCurve.size()<<" " << error<<" " << simplificationSize<<" "<< cpuTime << std::endl;
-  
-  displayContour(contour, aBoard);
-  
-  aBoard << r;
-  
-  for( int i=0; i < vectSeg.size(); i++){
-    aBoard << CustomStyle( vectSeg.at(i).className(),  new CustomPen( Color::Red, Color::Red, 4.0, 
-								      Board2D::Shape::SolidStyle,
-								      Board2D::Shape::RoundCap,
-								      Board2D::Shape::RoundJoin ) );
-    aBoard<< vectSeg.at(i);
-  }
-}
-
-
 
 
 
@@ -150,8 +77,15 @@ int main( int argc, char** argv )
   args.addOption( "-error", "-error <val>:parameter used in the simplification algorithm (Frechet or width) (default is 2)", "2" );
   args.addOption("-sdp", "-sdp <contour.sdp> : Import a contour as a Sequence of Discrete Points (SDP format)", "contour.sdp" );
   args.addOption( "-imageSize", "-imageSize <width> <height>: used to improve the output display to correspond to an source image by displaying an empty box of width 0 (to force the correspondance of the BB)", "", "" );
+  args.addOption("-errors", "-errors <e1,e2,...>: simplify for several errors at once, as nested levels; the vertices are written with their tolerance, the largest error for which they are kept (replaces -error)", "1,2,4,8" );
   args.addBooleanOption("-w", "-w: compute the simplification using the width only");
+  args.addBooleanOption("-closed", "-closed: simplify the contours as closed curves (their last point must be adjacent to the first, as for the contours of pgm2freeman)");
   args.addBooleanOption("-allContours", "-allContours: compute the simplification of all the contours (one contour per line given in sdp file)");
+  args.addBooleanOption("-binary", "-binary: the sdp file is in the binary contour format (as given by pgm2freeman -binary) instead of text (without -allContours, only its first contour is used)");
+  args.addOption("-threads", "-threads <n>: number of threads used to simplify the contours with -allContours (requires a build WITH_OPENMP, default is 1)", "1" );
+  args.addOption("-raster", "-raster <file.png>: also draw the result in a PNG image (PPM if the name ends with .ppm), as output.eps rendered by gs -dEPSCrop but without Ghostscript", "output.png" );
+  args.addOption("-resolution", "-resolution <dpi>: resolution of the -raster image (default is 72, one pixel per Postscript point)", "72" );
+  args.addBooleanOption("-noAntialiasing", "-noAntialiasing: draw the -raster image without antialiasing");
   
   bool parseOK=  args.readArguments( argc, argv );
   
@@ -173,35 +107,66 @@ int main( int argc, char** argv )
   if(args.check("-w"))
     flagWidthOnly = true;
 
+  int nbThreads = args.getOption("-threads")->getIntValue(0);
+  if(nbThreads < 1)
+    nbThreads = 1;
+#ifndef WITH_OPENMP
+  if(nbThreads > 1)
+    trace.warning() << "frechetSimplification built without OpenMP (WITH_OPENMP): -threads is ignored." << endl;
+#endif
+
 
   if( args.check("-sdp") && !args.check("-allContours")){
     std::vector<Z2i::Point> contour;
     string fileName = args.getOption("-sdp")->getValue(0);
-    contour =   PointListReader< Z2i::Point >::getPointsFromFile(fileName); 
+    if(args.check("-binary")){
+      BinaryContourReader< Z2i::Point > reader(fileName);
+      if(reader.size() > 0)
+	reader.getContour(0, contour);
+    }else{
+      contour =   PointListReader< Z2i::Point >::getPointsFromFile(fileName); 
+    }
     std::cout << "# curve_size error simplification_size cpu_time  "<< std::endl;
-    processContour(contour, board, error, f, flagWidthOnly, false);     
+    if(args.check("-errors"))
+      processContoursByErrors(std::vector< std::vector<Z2i::Point> >(1, contour), board, parseErrors(args.getOption("-errors")->getValue(0)), f, flagWidthOnly, 1, false, args.check("-closed"));
+    else
+      processContours(std::vector< std::vector<Z2i::Point> >(1, contour), board, error, f, flagWidthOnly, 1, false, args.check("-closed"));
+    ProfileZone epsZone("saveEPS");
     board.saveEPS("output.eps", 800, 800 ); 
+    epsZone.end();
+    if(args.check("-raster"))
+      saveRaster(board, args.getOption("-raster")->getValue(0), args.getOption("-resolution")->getFloatValue(0),
+		 !args.check("-noAntialiasing"), nbThreads);
   }
 
 
   if( args.check("-sdp") && args.check("-allContours")  ){
     string fileName = args.getOption("-sdp")->getValue(0);
-    std::vector< std::vector<Z2i::Point> > vectContours =   PointListReader< Z2i::Point >::getPolygonsFromFile(fileName);
+    ProfileZone readZone("read contours");
+    std::vector< std::vector<Z2i::Point> > vectContours =  args.check("-binary") ?
+      BinaryContourReader< Z2i::Point >::getPolygonsFromFile(fileName) :
+      PointListReader< Z2i::Point >::getPolygonsFromFile(fileName);
+    readZone.end();
     std::cout << "# curve_size error simplification_size cpu_time  " << std::endl;
-    for (int j=0; j<vectContours.size(); j++){
-      trace.info() << "# Processing contour " << j << endl;
-      processContour(vectContours.at(j), board, error,  f, flagWidthOnly, true); 
-    }    
-
-      if(args.check("-imageSize")){
-    unsigned int width = args.getOption("-imageSize")->getIntValue(0);
-    unsigned int height = args.getOption("-imageSize")->getIntValue(1);
-    board.setLineWidth(0.0);
-    board.setFillColor( DGtal::Color::None);
-    board.drawRectangle(0,height, width, height);
-  }
+    if(args.check("-errors"))
+      processContoursByErrors(vectContours, board, parseErrors(args.getOption("-errors")->getValue(0)), f, flagWidthOnly, nbThreads, true, args.check("-closed"));
+    else
+      processContours(vectContours, board, error, f, flagWidthOnly, nbThreads, true, args.check("-closed"));
+
+    if(args.check("-imageSize")){
+      unsigned int width = args.getOption("-imageSize")->getIntValue(0);
+      unsigned int height = args.getOption("-imageSize")->getIntValue(1);
+      board.setLineWidth(0.0);
+      board.setFillColor( DGtal::Color::None);
+      board.drawRectangle(0,height, width, height);
+    }
 
+    ProfileZone epsZone("saveEPS");
     board.saveEPS("output.eps", 800, 800); 
+    epsZone.end();
+    if(args.check("-raster"))
+      saveRaster(board, args.getOption("-raster")->getValue(0), args.getOption("-resolution")->getFloatValue(0),
+		 !args.check("-noAntialiasing"), nbThreads);
   }
 
 
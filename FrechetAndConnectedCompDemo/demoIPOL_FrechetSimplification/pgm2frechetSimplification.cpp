@@ -0,0 +1,186 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file pgm2frechetSimplification.cpp
+ *
+ * @date 2026/10/17
+ *
+ * Extracts the contours of a thresholded PGM image and simplifies them
+ * with the Frechet distance, in a single process: this is
+ * "pgm2freeman -outputSDPAll" followed by "frechetSimplification
+ * -allContours -imageSize", without the intermediate text file.
+ *
+ * This file is part of the IPOL source demo.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <algorithm>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageSelector.h"
+#include "DGtal/images/ImageHistogram.h"
+#include "DGtal/io/readers/PNMReader.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/base/ProfilerAllocations.h"
+
+#include "ImaGene/Arguments.h"
+
+#include "FrechetSimplification.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z2i;
+
+
+static ImaGene::Arguments args;
+
+typedef ImageSelector < Z2i::Domain, unsigned char>::Type Image;
+
+
+
+// same order as pgm2freeman -outputSDPAll: decreasing sizes.
+struct compContours {
+  bool operator() ( const std::vector< Z2i::Point > &cntA, const std::vector< Z2i::Point > &cntB ) { return (cntA.size()>cntB.size());}
+} myCompContour;
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  args.addOption("-image",  "-image: set the input image filename ", "image.pgm");
+  args.addOption( "-badj", "-badj <0/1>: 0 is interior bel adjacency, 1 is exterior (def. is 0).", "0" );
+  args.addOption( "-minThreshold", "-minThreshold <val>: minimal threshold value for binarizing PGM gray values (def. is 0).", "0" );
+  args.addOption( "-maxThreshold", "-maxThreshold <val>: maximal threshold value for binarizing PGM gray values (def. is given by the Otsu algorithm).", "128" );
+  args.addOption( "-min_size", "-min_size <m>: minimum digital length of contours for output (def. is 4).", "4" );
+  args.addOption( "-error", "-error <val>:parameter used in the simplification algorithm (Frechet or width) (default is 2)", "2" );
+  args.addOption("-errors", "-errors <e1,e2,...>: simplify for several errors at once, as nested levels; the vertices are written with their tolerance, the largest error for which they are kept (replaces -error)", "1,2,4,8" );
+  args.addBooleanOption("-w", "-w: compute the simplification using the width only");
+  args.addBooleanOption("-closed", "-closed: simplify the contours as closed curves (their last point must be adjacent to the first, as for the contours of pgm2freeman)");
+  args.addOption("-threads", "-threads <n>: number of threads used to simplify the contours (requires a build WITH_OPENMP, default is 1)", "1" );
+  args.addOption("-raster", "-raster <file.png>: also draw the result in a PNG image (PPM if the name ends with .ppm), as output.eps rendered by gs -dEPSCrop but without Ghostscript", "output.png" );
+  args.addOption("-resolution", "-resolution <dpi>: resolution of the -raster image (default is 72, one pixel per Postscript point)", "72" );
+  args.addBooleanOption("-noAntialiasing", "-noAntialiasing: draw the -raster image without antialiasing");
+
+  bool parseOK=  args.readArguments( argc, argv );
+
+  if ( ( argc <= 1 ) ||  ! parseOK || ! args.check("-image") )
+    {
+      cerr << args.usage( "pgm2frechetSimplification: ",
+			  "Description: extracts the contours of a thresholded PGM image and simplifies them with the Frechet distance (or the width). The vertices of the simplified contours are written in output.txt (one contour per line) and the drawing in output.eps.\nTypical use: \n pgm2frechetSimplification -image image.pgm -error 2 ",
+			  "" )
+	   << endl;
+      return 1;
+    }
+
+  std::string imageFileName = args.getOption("-image")->getValue(0);
+  int minThreshold = args.getOption("-minThreshold")->getIntValue(0);
+  int maxThreshold = args.getOption("-maxThreshold")->getIntValue(0);
+  unsigned int minSize = args.getOption("-min_size")->getIntValue(0);
+  bool badj = (args.getOption("-badj")->getIntValue(0))!=1;
+  double error = args.getOption("-error")->getFloatValue(0);
+  bool flagWidthOnly = args.check("-w");
+  int nbThreads = args.getOption("-threads")->getIntValue(0);
+  if(nbThreads < 1)
+    nbThreads = 1;
+#ifndef WITH_OPENMP
+  if(nbThreads > 1)
+    trace.warning() << "pgm2frechetSimplification built without OpenMP (WITH_OPENMP): -threads is ignored." << endl;
+#endif
+
+  ProfileZone readZone("importPGM");
+  Image image = PNMReader<Image>::importPGM( imageFileName );
+  readZone.end();
+  Z2i::KSpace ks;
+  if(! ks.init( image.domain().lowerBound(),
+		image.domain().upperBound(), true )){
+    trace.error() << "Problem in KSpace initialisation"<< std::endl;
+    return 1;
+  }
+
+  if (!args.check("-maxThreshold")&& !args.check("-minThreshold")){
+    minThreshold=0;
+    trace.info() << "Min/Max threshold values not specified, set min to 0 and computing max with the otsu algorithm...";
+    ImageHistogram::Histogram histo;
+    ImageHistogram::compute(image, histo);
+    maxThreshold = ImageHistogram::otsuThreshold(histo);
+    trace.info() << "[done] (max= " << maxThreshold << ") "<< std::endl;
+  }
+
+  typedef IntervalThresholder<Image::Value> Binarizer;
+  Binarizer b(minThreshold, maxThreshold);
+  PointFunctorPredicate<Image,Binarizer> predicate(image, b);
+  trace.info() << "DGtal contour extraction from thresholds ["<<  minThreshold << "," << maxThreshold << "]" ;
+  SurfelAdjacency<2> sAdj( badj );
+  std::vector< std::vector< Z2i::Point >  >  vectContoursBdryPointels;
+  ProfileZone extractZone("extractAllPointContours4C");
+  Surfaces<Z2i::KSpace>::extractAllPointContours4C( vectContoursBdryPointels,
+						    ks, predicate, sAdj );
+  extractZone.end();
+  trace.info()<< " [done] " << std::endl;
+
+  // The contours are selected and sorted as pgm2freeman -outputSDPAll
+  // does, which needs all of them before the simplification starts.
+  std::vector< std::vector< Z2i::Point >  >  vectContours;
+  for(unsigned int k=0; k<vectContoursBdryPointels.size(); k++){
+    if(vectContoursBdryPointels.at(k).size()>minSize){
+      vectContours.push_back(std::vector< Z2i::Point >());
+      vectContours.back().swap(vectContoursBdryPointels.at(k));
+    }
+  }
+  std::vector< std::vector< Z2i::Point >  >().swap(vectContoursBdryPointels);
+  std::sort (vectContours.begin(), vectContours.end(), myCompContour);
+  if(vectContours.empty()){
+    trace.error() << "The parameters given produce no contours." << std::endl;
+    return 1;
+  }
+
+  Board2D board;
+  ofstream f;
+  f.open("output.txt", std::ofstream::out);
+  std::cout << "# curve_size error simplification_size cpu_time  " << std::endl;
+  if(args.check("-errors"))
+    processContoursByErrors(vectContours, board, parseErrors(args.getOption("-errors")->getValue(0)), f, flagWidthOnly, nbThreads, true, args.check("-closed"));
+  else
+    processContours(vectContours, board, error, f, flagWidthOnly, nbThreads, true, args.check("-closed"));
+  f.close();
+
+  // empty box of the size of the image, as with frechetSimplification -imageSize.
+  unsigned int width = image.domain().upperBound()[0] - image.domain().lowerBound()[0] + 1;
+  unsigned int height = image.domain().upperBound()[1] - image.domain().lowerBound()[1] + 1;
+  board.setLineWidth(0.0);
+  board.setFillColor( DGtal::Color::None);
+  board.drawRectangle(0,height, width, height);
+  ProfileZone epsZone("saveEPS");
+  board.saveEPS("output.eps", 800, 800);
+  epsZone.end();
+  if(args.check("-raster"))
+    saveRaster(board, args.getOption("-raster")->getValue(0), args.getOption("-resolution")->getFloatValue(0),
+	       !args.check("-noAntialiasing"), nbThreads);
+
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -1103,6 +1103,14 @@ Board::save( const char * filename, double pageWidth, double pageHeight, double
     saveTikZ( filename, pageWidth, pageHeight, margin );
     return;
   }
+  if ( !(strcmp( extension, ".png" )) || !(strcmp( extension, ".PNG" )) ) {
+    saveRaster( filename, RasterPNG, pageWidth, pageHeight, margin );
+    return;
+  }
+  if ( !(strcmp( extension, ".ppm" )) || !(strcmp( extension, ".PPM" )) ) {
+    saveRaster( filename, RasterPPM, pageWidth, pageHeight, margin );
+    return;
+  }
 }
 
 void
@@ -1192,6 +1200,54 @@ Board::saveCairo( const char * filename, CairoType type, double pageWidth, doubl
 }
 #endif
 
+void
+Board::saveRaster( const char * filename, RasterType type, PageSize size, double margin,
+                   double resolution, bool antialiased, unsigned int nbThreads ) const
+{
+  saveRaster( filename, type, pageSizes[size][0], pageSizes[size][1], margin,
+              resolution, antialiased, nbThreads );
+}
+
+void
+Board::saveRaster( const char * filename, RasterType type, double pageWidth, double pageHeight,
+                   double margin, double resolution, bool antialiased, unsigned int nbThreads ) const
+{
+  Raster raster( antialiased, nbThreads );
+  rasterize( raster, pageWidth, pageHeight, margin, resolution );
+  std::ofstream file( filename, std::ios::out | std::ios::binary );
+  if ( type == RasterPPM )
+    raster.flushPPM( file );
+  else
+    raster.flushPNG( file );
+  file.close();
+}
+
+void
+Board::rasterize( Raster & raster, double pageWidth, double pageHeight,
+                  double margin, double resolution ) const
+{
+  Rect box = boundingBox();
+  bool clipping = _clippingPath.size() > 2;
+  if ( clipping )
+    box = box && _clippingPath.boundingBox();
+
+  TransformRaster transform;
+  transform.setResolution( resolution );
+  transform.setBoundingBox( box, pageWidth, pageHeight, margin );
+  raster.init( transform.width(), transform.height(), _backgroundColor );
+
+  // Draw the shapes
+  std::vector< Shape* > shapes = _shapes;
+  stable_sort( shapes.begin(), shapes.end(), shapeGreaterDepth );
+  std::vector< Shape* >::const_iterator i = shapes.begin();
+  std::vector< Shape* >::const_iterator end = shapes.end();
+  while ( i != end ) {
+    (*i)->flushRaster( raster, transform );
+    ++i;
+  }
+  raster.render();
+}
+
 void
 Board::saveTikZ( const char * filename, PageSize size, double margin ) const
 {
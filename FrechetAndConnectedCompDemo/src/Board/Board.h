@@ -39,6 +39,9 @@ public:
   // cairo
   enum CairoType { CairoPDF, CairoPNG, CairoPS, CairoEPS, CairoSVG };
 
+  // raster
+  enum RasterType { RasterPNG, RasterPPM };
+
   enum PageSize { BoundingBox, A4, Letter };
   enum Unit { UPoint, UInche, UCentimeter, UMillimeter };
   static const double Degree;
@@ -675,7 +678,7 @@ public:
           double angle = 0.0 );
 
   /** 
-   * Save the drawing in an EPS, XFIG of SVG file depending 
+   * Save the drawing in an EPS, XFIG, SVG, TikZ, PNG or PPM file depending 
    * on the filename extension. When a size is given (not BoundingBox), the drawing is
    * scaled (up or down) so that it fits within the dimension while keeping its aspect ratio.
    * 
@@ -686,7 +689,7 @@ public:
   void save( const char * filename, PageSize size = Board::BoundingBox, double margin = 10.0 ) const; 
   
   /** 
-   * Save the drawing in an EPS, XFIG of SVG file depending 
+   * Save the drawing in an EPS, XFIG, SVG, TikZ, PNG or PPM file depending 
    * on the filename extension. When a size is given (not BoundingBox), the drawing is
    * scaled (up or down) so that it fits within the dimension while keeping its aspect ratio.
    * 
@@ -870,6 +873,62 @@ public:
  
 #endif
 
+  /** 
+   * Save the drawing in a PNG or PPM image, drawn by the scanline
+   * rasterizer of Raster (no external dependency). The image is the
+   * EPS file of saveEPS(), cropped to its bounding box and seen at the
+   * given resolution (as "gs -dEPSCrop -r<resolution>" renders it).
+   * Texts are not drawn and lines are drawn solid.
+   * 
+   * @param filename The name of the file.
+   * @param type Output type: RasterPNG or RasterPPM.
+   * @param size Page size (Either BoundingBox (default), A4 or Letter).
+   * @param margin Minimal margin around the figure in the page, in millimeters.
+   * @param resolution The number of pixels per inch (72 gives a pixel per Postscript point).
+   * @param antialiased When true, the boundaries of the shapes are antialiased.
+   * @param nbThreads The number of threads (requires a build WITH_OPENMP).
+   */
+  void saveRaster( const char * filename, RasterType type = RasterPNG,
+                   PageSize size = Board::BoundingBox, double margin = 10.0,
+                   double resolution = 72.0, bool antialiased = true,
+                   unsigned int nbThreads = 1 ) const;
+
+  /** 
+   * Save the drawing in a PNG or PPM image, drawn by the scanline
+   * rasterizer of Raster (no external dependency). The drawing is
+   * scaled (up or down) so that it fits within the page while keeping
+   * its aspect ratio, as in saveEPS(), and the image is cropped to its
+   * bounding box.
+   * 
+   * @param filename The name of the file.
+   * @param type Output type: RasterPNG or RasterPPM.
+   * @param pageWidth Width of the page in millimeters.
+   * @param pageHeight Height of the page in millimeters.
+   * @param margin Minimal margin around the figure in the page, in millimeters.
+   * @param resolution The number of pixels per inch (72 gives a pixel per Postscript point).
+   * @param antialiased When true, the boundaries of the shapes are antialiased.
+   * @param nbThreads The number of threads (requires a build WITH_OPENMP).
+   */
+  void saveRaster( const char * filename, RasterType type,
+                   double pageWidth, double pageHeight, double margin = 10.0,
+                   double resolution = 72.0, bool antialiased = true,
+                   unsigned int nbThreads = 1 ) const;
+
+  /** 
+   * Draws the board in a raster image, which is resized to the
+   * bounding box of the drawing, scaled as in saveEPS() and seen at
+   * the given resolution. The antialiasing mode and the
+   * number of threads are those of the raster.
+   * 
+   * @param raster The raster image.
+   * @param pageWidth Width of the page in millimeters (0 for the bounding box).
+   * @param pageHeight Height of the page in millimeters (0 for the bounding box).
+   * @param margin Minimal margin around the figure in the page, in millimeters.
+   * @param resolution The number of pixels per inch.
+   */
+  void rasterize( Raster & raster, double pageWidth, double pageHeight,
+                  double margin = 10.0, double resolution = 72.0 ) const;
+
   /** 
    * Save the drawing in an TikZ file. When a size is given (not BoundingBox), the drawing is
    * scaled (up or down) so that it fits within the dimension while keeping its aspect ratio.
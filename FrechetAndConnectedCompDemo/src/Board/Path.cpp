@@ -268,6 +268,20 @@ Path::flushTikZPoints( std::ostream & stream,
   }
 }
 
+void
+Path::flushRasterPoints( std::vector<Point> & points,
+     const TransformRaster & transform ) const
+{
+  points.clear();
+  points.reserve( _points.size() );
+  std::vector<Point>::const_iterator i = _points.begin();
+  std::vector<Point>::const_iterator end = _points.end();
+  while ( i != end ) {
+    points.push_back( Point( transform.mapX( i->x ), transform.mapY( i->y ) ) );
+    ++i;
+  }
+}
+
 Rect
 Path::boundingBox() const
 {
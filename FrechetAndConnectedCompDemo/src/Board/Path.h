@@ -213,6 +213,9 @@ struct Path {
   void flushTikZPoints( std::ostream & stream,
      const TransformTikZ & transform ) const;
 
+  void flushRasterPoints( std::vector<Point> & points,
+     const TransformRaster & transform ) const;
+
   Rect boundingBox() const;
 
 protected:
@@ -0,0 +1,591 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file   Raster.cpp
+ * @date   Oct 2026
+ *
+ * @brief  A scanline rasterizer for the shapes of a board.
+ */
+/*
+ * \@copyright This File is part of the Board library which is
+ * licensed under the terms of the GNU Lesser General Public Licence.
+ * See the LICENCE file for further details.
+ */
+#include "Board/Raster.h"
+#include "Board/Shapes.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#ifndef M_PI
+#define M_PI    3.14159265358979323846  /* pi */
+#endif
+
+namespace {
+
+  /** Number of sub-scanlines per pixel row in antialiased mode. */
+  const unsigned int subScanlines = 4;
+
+  /** Number of pixel rows of a band rendered by render(). */
+  const unsigned int bandHeight = 16;
+
+  /** Maximal distance, in pixels, between a disk and its polygon. */
+  const double diskTolerance = 0.1;
+
+  /** Postscript default miter limit. */
+  const double miterLimit = 10.0;
+
+  bool crossingLess( const std::pair<double,int> & a, const std::pair<double,int> & b )
+  {
+    return a.first < b.first;
+  }
+
+  /**
+   * Little-endian bit writer of a deflate stream, with the fixed
+   * Huffman code of the literals and lengths.
+   */
+  struct DeflateWriter {
+    DeflateWriter( std::vector<unsigned char> & out )
+      : _out( out ), _bits( 0 ), _nbBits( 0 )
+    {
+      // Huffman codes are packed starting with their most significant bit.
+      for ( unsigned int symbol = 0; symbol < 288; ++symbol ) {
+        unsigned int code, length;
+        if ( symbol < 144 ) { code = 0x30 + symbol; length = 8; }
+        else if ( symbol < 256 ) { code = 0x190 + symbol - 144; length = 9; }
+        else if ( symbol < 280 ) { code = symbol - 256; length = 7; }
+        else { code = 0xC0 + symbol - 280; length = 8; }
+        unsigned int reversed = 0;
+        for ( unsigned int i = 0; i < length; ++i )
+          reversed |= ( ( code >> i ) & 1 ) << ( length - 1 - i );
+        _codes[ symbol ] = reversed;
+        _lengths[ symbol ] = length;
+      }
+    }
+
+    void put( unsigned int value, unsigned int nbBits ) {
+      _bits |= static_cast<unsigned long>( value ) << _nbBits;
+      _nbBits += nbBits;
+      while ( _nbBits >= 8 ) {
+        _out.push_back( static_cast<unsigned char>( _bits & 0xFF ) );
+        _bits >>= 8;
+        _nbBits -= 8;
+      }
+    }
+
+    void putSymbol( unsigned int symbol ) {
+      put( _codes[ symbol ], _lengths[ symbol ] );
+    }
+
+    /** Writes a copy of the previous byte, 3 <= length <= 258 times. */
+    void putRepeat( unsigned int length ) {
+      static const unsigned int base[] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27,
+                                           31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+      static const unsigned int extra[] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+                                            2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+      unsigned int code = static_cast<unsigned int>( std::upper_bound( base, base + 29, length ) - base ) - 1;
+      putSymbol( 257 + code );
+      put( length - base[ code ], extra[ code ] );
+      put( 0, 5 ); // Distance 1.
+    }
+
+    void flush() {
+      if ( _nbBits > 0 )
+        _out.push_back( static_cast<unsigned char>( _bits & 0xFF ) );
+      _bits = 0;
+      _nbBits = 0;
+    }
+
+    std::vector<unsigned char> & _out;
+    unsigned long _bits;
+    unsigned int _nbBits;
+    unsigned int _codes[ 288 ];
+    unsigned int _lengths[ 288 ];
+  };
+
+  /**
+   * Encodes a byte stream with the fixed Huffman code, runs of a same
+   * byte being copies at distance 1, and computes its Adler-32
+   * checksum.
+   */
+  struct RunEncoder {
+    RunEncoder( DeflateWriter & writer )
+      : _writer( writer ), _last( 0 ), _hasLast( false ), _run( 0 ),
+        _adlerA( 1 ), _adlerB( 0 ) { }
+
+    void push( const unsigned char * data, std::size_t n ) {
+      // The sums fit in 32 bits for 5552 bytes between two reductions.
+      for ( std::size_t i = 0; i < n; ) {
+        const std::size_t end = std::min( n, i + 5552 );
+        for ( ; i < end; ++i ) {
+          _adlerA += data[ i ];
+          _adlerB += _adlerA;
+        }
+        _adlerA %= 65521;
+        _adlerB %= 65521;
+      }
+      for ( std::size_t i = 0; i < n; ) {
+        std::size_t j = i + 1;
+        while ( j < n && data[ j ] == data[ i ] ) ++j;
+        pushRun( data[ i ], j - i );
+        i = j;
+      }
+    }
+
+    void pushRun( unsigned char c, std::size_t count ) {
+      if ( !_hasLast || c != _last ) {
+        flushRun();
+        _writer.putSymbol( c );
+        _last = c;
+        _hasLast = true;
+        --count;
+      }
+      while ( count > 0 ) {
+        const std::size_t k = std::min( count, static_cast<std::size_t>( 258 - _run ) );
+        _run += static_cast<unsigned int>( k );
+        count -= k;
+        if ( _run == 258 ) flushRun();
+      }
+    }
+
+    void flushRun() {
+      if ( _run >= 3 )
+        _writer.putRepeat( _run );
+      else
+        for ( unsigned int i = 0; i < _run; ++i )
+          _writer.putSymbol( _last );
+      _run = 0;
+    }
+
+    unsigned long adler32() const { return ( _adlerB << 16 ) | _adlerA; }
+
+    DeflateWriter & _writer;
+    unsigned char _last;
+    bool _hasLast;
+    unsigned int _run;
+    unsigned long _adlerA;
+    unsigned long _adlerB;
+  };
+
+  void putBigEndian( std::vector<unsigned char> & out, unsigned long value )
+  {
+    out.push_back( static_cast<unsigned char>( ( value >> 24 ) & 0xFF ) );
+    out.push_back( static_cast<unsigned char>( ( value >> 16 ) & 0xFF ) );
+    out.push_back( static_cast<unsigned char>( ( value >> 8 ) & 0xFF ) );
+    out.push_back( static_cast<unsigned char>( value & 0xFF ) );
+  }
+
+  /**
+   * Writes a PNG chunk: length, type, data and CRC.
+   */
+  void flushPNGChunk( std::ostream & out, const char * type,
+                      const std::vector<unsigned char> & data,
+                      const unsigned long * crcTable )
+  {
+    std::vector<unsigned char> chunk;
+    putBigEndian( chunk, static_cast<unsigned long>( data.size() ) );
+    chunk.insert( chunk.end(), type, type + 4 );
+    chunk.insert( chunk.end(), data.begin(), data.end() );
+    unsigned long crc = 0xFFFFFFFFUL;
+    for ( std::size_t i = 4; i < chunk.size(); ++i )
+      crc = crcTable[ ( crc ^ chunk[ i ] ) & 0xFF ] ^ ( crc >> 8 );
+    putBigEndian( chunk, crc ^ 0xFFFFFFFFUL );
+    out.write( reinterpret_cast<const char *>( &chunk[ 0 ] ), chunk.size() );
+  }
+}
+
+namespace LibBoard {
+
+Raster::Raster( bool antialiased, unsigned int nbThreads )
+  : _antialiased( antialiased ), _nbThreads( nbThreads > 0 ? nbThreads : 1 ),
+    _width( 0 ), _height( 0 )
+{
+}
+
+void
+Raster::init( unsigned int width, unsigned int height,
+              const DGtal::Color & background )
+{
+  _width = width;
+  _height = height;
+  _items.clear();
+  _pixels.resize( 3 * static_cast<std::size_t>( width ) * height );
+  unsigned char rgb[ 3 ] = { 255, 255, 255 };
+  if ( background != DGtal::Color::None ) {
+    rgb[ 0 ] = background.red();
+    rgb[ 1 ] = background.green();
+    rgb[ 2 ] = background.blue();
+  }
+  for ( std::size_t i = 0; i < _pixels.size(); i += 3 ) {
+    _pixels[ i ] = rgb[ 0 ];
+    _pixels[ i + 1 ] = rgb[ 1 ];
+    _pixels[ i + 2 ] = rgb[ 2 ];
+  }
+}
+
+bool
+Raster::edgeStartsAbove( const Edge & a, const Edge & b )
+{
+  return a.y0 < b.y0;
+}
+
+Raster::Item &
+Raster::newItem( const DGtal::Color & color )
+{
+  _items.push_back( Item() );
+  Item & item = _items.back();
+  item.color = color;
+  item.xMin = item.yMin = std::numeric_limits<double>::max();
+  item.xMax = item.yMax = -std::numeric_limits<double>::max();
+  return item;
+}
+
+void
+Raster::addContour( Item & item, const std::vector<Point> & points, bool oriented )
+{
+  const std::size_t n = points.size();
+  if ( n < 3 ) return;
+  bool reversed = false;
+  if ( oriented ) {
+    double area = 0.0;
+    for ( std::size_t i = 0; i < n; ++i ) {
+      const Point & p = points[ i ];
+      const Point & q = points[ ( i + 1 ) % n ];
+      area += p.x * q.y - q.x * p.y;
+    }
+    reversed = area < 0.0;
+  }
+  for ( std::size_t i = 0; i < n; ++i ) {
+    const Point & p = points[ i ];
+    const Point & q = points[ ( i + 1 ) % n ];
+    item.xMin = std::min( item.xMin, p.x );
+    item.xMax = std::max( item.xMax, p.x );
+    item.yMin = std::min( item.yMin, p.y );
+    item.yMax = std::max( item.yMax, p.y );
+    if ( p.y == q.y ) continue;
+    Edge e;
+    const Point & top = ( p.y < q.y ) ? p : q;
+    const Point & bottom = ( p.y < q.y ) ? q : p;
+    e.x0 = top.x;
+    e.y0 = top.y;
+    e.y1 = bottom.y;
+    e.dxdy = ( bottom.x - top.x ) / ( bottom.y - top.y );
+    e.winding = ( ( p.y < q.y ) != reversed ) ? 1 : -1;
+    item.edges.push_back( e );
+  }
+}
+
+void
+Raster::addDisk( Item & item, const Point & center, double radius )
+{
+  unsigned int n = 4;
+  if ( radius > diskTolerance ) {
+    double step = 2.0 * std::acos( 1.0 - diskTolerance / radius );
+    n = std::max( n, static_cast<unsigned int>( std::ceil( 2.0 * M_PI / step ) ) );
+  }
+  n = std::min( n, 256u );
+  std::vector<Point> points( n );
+  for ( unsigned int i = 0; i < n; ++i ) {
+    double angle = ( 2.0 * M_PI * i ) / n;
+    points[ i ] = Point( center.x + radius * std::cos( angle ),
+                         center.y + radius * std::sin( angle ) );
+  }
+  addContour( item, points, true );
+}
+
+void
+Raster::closeItem()
+{
+  Item & item = _items.back();
+  if ( item.edges.empty()
+       || item.xMax < 0.0 || item.xMin > _width
+       || item.yMax < 0.0 || item.yMin > _height ) {
+    _items.pop_back();
+    return;
+  }
+  std::sort( item.edges.begin(), item.edges.end(), edgeStartsAbove );
+}
+
+void
+Raster::fillPolygon( const std::vector<Point> & points, const DGtal::Color & color )
+{
+  if ( color == DGtal::Color::None || points.size() < 3 ) return;
+  addContour( newItem( color ), points, false );
+  closeItem();
+}
+
+void
+Raster::strokePolyline( const std::vector<Point> & points, bool closed,
+                        double width, int lineCap, int lineJoin,
+                        const DGtal::Color & color )
+{
+  if ( color == DGtal::Color::None || points.empty() ) return;
+  const double hw = 0.5 * std::max( width, 1.0 );
+
+  std::vector<Point> v;
+  v.reserve( points.size() );
+  for ( std::size_t i = 0; i < points.size(); ++i )
+    if ( v.empty() || points[ i ].x != v.back().x || points[ i ].y != v.back().y )
+      v.push_back( points[ i ] );
+  if ( closed && v.size() > 1 && v.front().x == v.back().x && v.front().y == v.back().y )
+    v.pop_back();
+
+  Item & item = newItem( color );
+  std::vector<Point> piece;
+
+  // A single point: only round and square caps are visible.
+  if ( v.size() == 1 ) {
+    if ( lineCap == Shape::RoundCap )
+      addDisk( item, v[ 0 ], hw );
+    else if ( lineCap == Shape::SquareCap ) {
+      piece.push_back( Point( v[ 0 ].x - hw, v[ 0 ].y - hw ) );
+      piece.push_back( Point( v[ 0 ].x + hw, v[ 0 ].y - hw ) );
+      piece.push_back( Point( v[ 0 ].x + hw, v[ 0 ].y + hw ) );
+      piece.push_back( Point( v[ 0 ].x - hw, v[ 0 ].y + hw ) );
+      addContour( item, piece, true );
+    }
+    closeItem();
+    return;
+  }
+
+  const std::size_t n = v.size();
+  const std::size_t nbSegments = closed ? n : n - 1;
+  std::vector<Point> directions( nbSegments );
+  for ( std::size_t i = 0; i < nbSegments; ++i ) {
+    Point d = v[ ( i + 1 ) % n ] - v[ i ];
+    directions[ i ] = d / d.norm();
+  }
+
+  // One quadrilateral per segment.
+  for ( std::size_t i = 0; i < nbSegments; ++i ) {
+    const Point & d = directions[ i ];
+    const Point normal( -d.y * hw, d.x * hw );
+    Point start = v[ i ];
+    Point end = v[ ( i + 1 ) % n ];
+    if ( !closed && lineCap == Shape::SquareCap ) {
+      if ( i == 0 ) start -= d * hw;
+      if ( i + 1 == nbSegments ) end += d * hw;
+    }
+    piece.clear();
+    piece.push_back( start + normal );
+    piece.push_back( end + normal );
+    piece.push_back( end - normal );
+    piece.push_back( start - normal );
+    addContour( item, piece, true );
+  }
+
+  // Caps.
+  if ( !closed && lineCap == Shape::RoundCap ) {
+    addDisk( item, v.front(), hw );
+    addDisk( item, v.back(), hw );
+  }
+
+  // Joins, at the vertices shared by two segments.
+  for ( std::size_t j = closed ? 0 : 1; j < ( closed ? n : n - 1 ); ++j ) {
+    const Point & vertex = v[ j ];
+    if ( lineJoin == Shape::RoundJoin ) {
+      addDisk( item, vertex, hw );
+      continue;
+    }
+    const Point & d0 = directions[ ( j + nbSegments - 1 ) % nbSegments ];
+    const Point & d1 = directions[ j % nbSegments ];
+    const double cross = d0.x * d1.y - d0.y * d1.x;
+    const double dot = d0 * d1;
+    if ( cross == 0.0 && dot > 0.0 ) continue;
+    // The join is on the outer side of the turn.
+    const double side = ( cross > 0.0 ) ? -hw : hw;
+    const Point o0 = vertex + Point( -d0.y, d0.x ) * side;
+    const Point o1 = vertex + Point( -d1.y, d1.x ) * side;
+    piece.clear();
+    piece.push_back( vertex );
+    piece.push_back( o0 );
+    if ( lineJoin == Shape::MiterJoin && 1.0 + dot >= 2.0 / ( miterLimit * miterLimit ) )
+      piece.push_back( o0 + d0 * ( hw * std::fabs( cross ) / ( 1.0 + dot ) ) );
+    piece.push_back( o1 );
+    addContour( item, piece, true );
+  }
+  closeItem();
+}
+
+void
+Raster::render()
+{
+  const int nbBands = static_cast<int>( ( _height + bandHeight - 1 ) / bandHeight );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(_nbThreads)
+#endif
+  for ( int band = 0; band < nbBands; ++band )
+    renderBand( band * bandHeight, std::min( ( band + 1 ) * bandHeight, _height ) );
+  _items.clear();
+}
+
+void
+Raster::renderBand( unsigned int rowBegin, unsigned int rowEnd )
+{
+  const unsigned int nbSamples = _antialiased ? subScanlines : 1;
+  const double sampleWeight = 1.0 / nbSamples;
+  // Coverage of each pixel of a row: cover[x] plus the sum of delta[0..x].
+  std::vector<double> cover( _width + 2, 0.0 );
+  std::vector<double> delta( _width + 2, 0.0 );
+  std::vector<const Edge*> edges;
+  std::vector< std::pair<double,int> > crossings;
+
+  for ( std::vector<Item>::const_iterator item = _items.begin(), end = _items.end();
+        item != end; ++item ) {
+    if ( item->yMax <= rowBegin || item->yMin >= rowEnd ) continue;
+    edges.clear();
+    for ( std::vector<Edge>::const_iterator e = item->edges.begin(), eEnd = item->edges.end();
+          e != eEnd && e->y0 < rowEnd; ++e )
+      if ( e->y1 > rowBegin )
+        edges.push_back( &*e );
+
+    const unsigned int first = std::max( rowBegin, static_cast<unsigned int>( std::max( 0.0, std::floor( item->yMin ) ) ) );
+    const unsigned int last = std::min( rowEnd, static_cast<unsigned int>( std::ceil( item->yMax ) ) );
+    const double alpha = item->color.alpha() / 255.0;
+    for ( unsigned int row = first; row < last; ++row ) {
+      std::size_t lo = _width + 1;
+      std::size_t hi = 0;
+      for ( unsigned int sample = 0; sample < nbSamples; ++sample ) {
+        const double y = row + ( sample + 0.5 ) * sampleWeight;
+        crossings.clear();
+        for ( std::vector<const Edge*>::const_iterator it = edges.begin(), itEnd = edges.end();
+              it != itEnd; ++it ) {
+          const Edge & e = **it;
+          if ( e.y0 <= y && y < e.y1 )
+            crossings.push_back( std::make_pair( e.x0 + ( y - e.y0 ) * e.dxdy, e.winding ) );
+        }
+        if ( crossings.empty() ) continue;
+        std::sort( crossings.begin(), crossings.end(), crossingLess );
+        int winding = 0;
+        double spanStart = 0.0;
+        for ( std::size_t i = 0; i < crossings.size(); ++i ) {
+          const int previous = winding;
+          winding += crossings[ i ].second;
+          if ( previous == 0 && winding != 0 ) {
+            spanStart = crossings[ i ].first;
+            continue;
+          }
+          if ( previous == 0 || winding != 0 ) continue;
+          // Span [spanStart, crossings[i].first) is inside.
+          double a = std::max( spanStart, 0.0 );
+          double b = std::min( crossings[ i ].first, static_cast<double>( _width ) );
+          if ( b <= a ) continue;
+          if ( _antialiased ) {
+            std::size_t ia = static_cast<std::size_t>( a );
+            std::size_t ib = static_cast<std::size_t>( b );
+            if ( ia == ib )
+              cover[ ia ] += ( b - a ) * sampleWeight;
+            else {
+              cover[ ia ] += ( ia + 1 - a ) * sampleWeight;
+              delta[ ia + 1 ] += sampleWeight;
+              delta[ ib ] -= sampleWeight;
+              cover[ ib ] += ( b - ib ) * sampleWeight;
+            }
+            lo = std::min( lo, ia );
+            hi = std::max( hi, ib + 1 );
+          } else {
+            // Pixels whose center is in [a,b).
+            std::size_t ia = static_cast<std::size_t>( std::ceil( a - 0.5 ) );
+            std::size_t ib = static_cast<std::size_t>( std::ceil( b - 0.5 ) );
+            if ( ib <= ia ) continue;
+            delta[ ia ] += 1.0;
+            delta[ ib ] -= 1.0;
+            lo = std::min( lo, ia );
+            hi = std::max( hi, ib + 1 );
+          }
+        }
+      }
+      if ( hi <= lo ) continue;
+
+      unsigned char * rowPixels = &_pixels[ 3 * static_cast<std::size_t>( row ) * _width ];
+      const double rgb[ 3 ] = { static_cast<double>( item->color.red() ),
+                                static_cast<double>( item->color.green() ),
+                                static_cast<double>( item->color.blue() ) };
+      double running = 0.0;
+      for ( std::size_t x = lo; x < hi; ++x ) {
+        running += delta[ x ];
+        double coverage = cover[ x ] + running;
+        cover[ x ] = 0.0;
+        delta[ x ] = 0.0;
+        if ( x >= _width || coverage <= 1e-9 ) continue;
+        const double a = std::min( coverage, 1.0 ) * alpha;
+        unsigned char * pixel = rowPixels + 3 * x;
+        for ( unsigned int c = 0; c < 3; ++c )
+          pixel[ c ] = static_cast<unsigned char>( pixel[ c ] + ( rgb[ c ] - pixel[ c ] ) * a + 0.5 );
+      }
+    }
+  }
+}
+
+DGtal::Color
+Raster::pixel( unsigned int x, unsigned int y ) const
+{
+  const unsigned char * p = &_pixels[ 3 * ( static_cast<std::size_t>( y ) * _width + x ) ];
+  return DGtal::Color( p[ 0 ], p[ 1 ], p[ 2 ] );
+}
+
+void
+Raster::flushPPM( std::ostream & out ) const
+{
+  out << "P6\n" << _width << " " << _height << "\n255\n";
+  if ( !_pixels.empty() )
+    out.write( reinterpret_cast<const char *>( &_pixels[ 0 ] ), _pixels.size() );
+}
+
+void
+Raster::flushPNG( std::ostream & out ) const
+{
+  unsigned long crcTable[ 256 ];
+  for ( unsigned long n = 0; n < 256; ++n ) {
+    unsigned long c = n;
+    for ( unsigned int k = 0; k < 8; ++k )
+      c = ( c & 1 ) ? ( 0xEDB88320UL ^ ( c >> 1 ) ) : ( c >> 1 );
+    crcTable[ n ] = c;
+  }
+
+  static const unsigned char signature[ 8 ] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+  out.write( reinterpret_cast<const char *>( signature ), 8 );
+
+  std::vector<unsigned char> header;
+  putBigEndian( header, _width );
+  putBigEndian( header, _height );
+  header.push_back( 8 );  // Bit depth.
+  header.push_back( 2 );  // RGB.
+  header.push_back( 0 );  // Deflate.
+  header.push_back( 0 );  // Adaptive filtering.
+  header.push_back( 0 );  // No interlace.
+  flushPNGChunk( out, "IHDR", header, crcTable );
+
+  // zlib stream, made of one block with fixed Huffman codes. A row
+  // equal to the previous one is filtered with "Up" (all zeros), the
+  // others with "Sub": a plain background becomes runs of zeros.
+  std::vector<unsigned char> data;
+  data.push_back( 0x78 );
+  data.push_back( 0x01 );
+  DeflateWriter writer( data );
+  writer.put( 1, 1 ); // Last block.
+  writer.put( 1, 2 ); // Fixed Huffman codes.
+  RunEncoder encoder( writer );
+  const std::size_t rowSize = 3 * static_cast<std::size_t>( _width );
+  std::vector<unsigned char> filtered( rowSize + 1 );
+  for ( unsigned int y = 0; y < _height; ++y ) {
+    const unsigned char * row = &_pixels[ y * rowSize ];
+    if ( y > 0 && std::equal( row, row + rowSize, row - rowSize ) ) {
+      filtered[ 0 ] = 2;
+      std::fill( filtered.begin() + 1, filtered.end(), 0 );
+    } else {
+      filtered[ 0 ] = 1;
+      for ( std::size_t i = 0; i < rowSize; ++i )
+        filtered[ i + 1 ] = static_cast<unsigned char>( i < 3 ? row[ i ] : row[ i ] - row[ i - 3 ] );
+    }
+    encoder.push( &filtered[ 0 ], filtered.size() );
+  }
+  encoder.flushRun();
+  writer.putSymbol( 256 );
+  writer.flush();
+  putBigEndian( data, encoder.adler32() );
+  flushPNGChunk( out, "IDAT", data, crcTable );
+
+  flushPNGChunk( out, "IEND", std::vector<unsigned char>(), crcTable );
+}
+
+} // namespace LibBoard
@@ -0,0 +1,192 @@
+/* -*- mode: c++ -*- */
+/**
+ * @file   Raster.h
+ * @date   Oct 2026
+ *
+ * @brief  A scanline rasterizer for the shapes of a board.
+ */
+/*
+ * \@copyright This File is part of the Board library which is
+ * licensed under the terms of the GNU Lesser General Public Licence.
+ * See the LICENCE file for further details.
+ */
+#ifndef _BOARD_RASTER_H_
+#define _BOARD_RASTER_H_
+
+#include "Board/Point.h"
+#include <iostream>
+#include <vector>
+#include <utility>
+
+#include "DGtal/io/Color.h"
+
+namespace LibBoard {
+
+/**
+ * The Raster structure.
+ * @brief An RGB image in which shapes are drawn by a scanline
+ * rasterizer.
+ *
+ * Shapes record their outlines, in pixel coordinates, with
+ * fillPolygon() and strokePolyline(). Each call adds one item to a
+ * display list; render() then fills the items in order with the
+ * nonzero winding rule and blends them over the background. A stroke
+ * is the union of one quadrilateral per segment and of the caps and
+ * joins, so that overlapping pieces are painted only once.
+ *
+ * In antialiased mode, each pixel row is sampled by several
+ * sub-scanlines and the horizontal coverage of the spans is exact.
+ * Otherwise, a pixel is painted when its center is inside the shape.
+ *
+ * render() processes the image by bands of rows. They are independent
+ * and are rendered by several threads when the library is built
+ * WITH_OPENMP; the result does not depend on the number of threads.
+ */
+struct Raster {
+
+  /**
+   * Raster constructor.
+   *
+   * @param antialiased When true, the pixels at the boundary of the shapes are blended
+   * according to their coverage.
+   * @param nbThreads The number of threads used by render() (needs WITH_OPENMP).
+   */
+  Raster( bool antialiased = true, unsigned int nbThreads = 1 );
+
+  /**
+   * Clears the display list and resizes the image.
+   *
+   * @param width The width of the image, in pixels.
+   * @param height The height of the image, in pixels.
+   * @param background The color of the background (white if None).
+   */
+  void init( unsigned int width, unsigned int height,
+             const DGtal::Color & background );
+
+  inline unsigned int width() const { return _width; }
+
+  inline unsigned int height() const { return _height; }
+
+  inline bool antialiased() const { return _antialiased; }
+
+  /**
+   * Adds a filled polygon to the display list.
+   *
+   * @param points The vertices of the polygon, in pixel coordinates.
+   * @param color The fill color.
+   */
+  void fillPolygon( const std::vector<Point> & points, const DGtal::Color & color );
+
+  /**
+   * Adds the stroke of a polygonal line to the display list. Line
+   * styles are not handled: the line is drawn solid. A line thinner
+   * than a pixel is drawn one pixel wide, as the thinnest Postscript
+   * line.
+   *
+   * @param points The vertices of the line, in pixel coordinates.
+   * @param closed When true, the last vertex is joined to the first one.
+   * @param width The line width, in pixels.
+   * @param lineCap The type of line extremities (a Shape::LineCap).
+   * @param lineJoin The type of line junctions (a Shape::LineJoin).
+   * @param color The pen color.
+   */
+  void strokePolyline( const std::vector<Point> & points, bool closed,
+                       double width, int lineCap, int lineJoin,
+                       const DGtal::Color & color );
+
+  /**
+   * Draws the items of the display list in the image, then clears the list.
+   */
+  void render();
+
+  /**
+   * Returns the color of a pixel.
+   *
+   * @param x The column, from left to right.
+   * @param y The row, from top to bottom.
+   *
+   * @return The color of the pixel.
+   */
+  DGtal::Color pixel( unsigned int x, unsigned int y ) const;
+
+  /**
+   * Writes the image in binary PPM (P6) format.
+   *
+   * @param out The output stream.
+   */
+  void flushPPM( std::ostream & out ) const;
+
+  /**
+   * Writes the image in PNG format (8 bits RGB). The deflate stream
+   * only encodes the repetitions of each row, which is quick and
+   * enough for drawings on a plain background.
+   *
+   * @param out The output stream.
+   */
+  void flushPNG( std::ostream & out ) const;
+
+private:
+
+  /**
+   * A non horizontal edge, with y0 < y1.
+   */
+  struct Edge {
+    double x0, y0, y1, dxdy;
+    int winding;
+  };
+
+  /**
+   * An item of the display list.
+   */
+  struct Item {
+    std::vector<Edge> edges; /**< Sorted by y0. */
+    DGtal::Color color;
+    double xMin, xMax, yMin, yMax;
+  };
+
+  /**
+   * Starts a new item of the display list.
+   */
+  Item & newItem( const DGtal::Color & color );
+
+  /**
+   * Adds a closed contour to an item.
+   *
+   * @param item The item.
+   * @param points The vertices of the contour.
+   * @param oriented When true, the contour is reversed if needed so
+   * that all the pieces of a stroke turn in the same direction.
+   */
+  void addContour( Item & item, const std::vector<Point> & points, bool oriented );
+
+  /**
+   * Adds a disk (as a regular polygon) to an item.
+   */
+  void addDisk( Item & item, const Point & center, double radius );
+
+  /**
+   * Sorts the edges of an item, or removes it when empty.
+   */
+  void closeItem();
+
+  /**
+   * Renders the rows [rowBegin,rowEnd) of the image.
+   */
+  void renderBand( unsigned int rowBegin, unsigned int rowEnd );
+
+  /**
+   * Orders the edges by their upper end.
+   */
+  static bool edgeStartsAbove( const Edge & a, const Edge & b );
+
+  bool _antialiased;
+  unsigned int _nbThreads;
+  unsigned int _width;
+  unsigned int _height;
+  std::vector<unsigned char> _pixels; /**< RGB, row by row from the top. */
+  std::vector<Item> _items;
+};
+
+} // namespace LibBoard
+
+#endif /* _BOARD_RASTER_H_ */
@@ -375,6 +375,20 @@ ShapeList::flushTikZ( std::ostream & stream,
     stream << "\\end{scope}\n";
 }
 
+void
+ShapeList::flushRaster( Raster & raster,
+                        const TransformRaster & transform ) const
+{
+    std::vector< Shape* > shapes = _shapes;
+    stable_sort( shapes.begin(), shapes.end(), shapeGreaterDepth );
+    std::vector< Shape* >::const_iterator i = shapes.begin();
+    std::vector< Shape* >::const_iterator end = shapes.end();
+    while ( i != end ) {
+        (*i)->flushRaster( raster, transform );
+        ++i;
+    }
+}
+
 Rect
 ShapeList::boundingBox() const
 {
@@ -91,6 +91,9 @@ struct ShapeList : public Shape {
   void flushTikZ( std::ostream & stream,
      const TransformTikZ & transform ) const;
 
+  void flushRaster( Raster & raster,
+     const TransformRaster & transform ) const;
+
   Rect boundingBox() const;
   
   virtual int minDepth() const;
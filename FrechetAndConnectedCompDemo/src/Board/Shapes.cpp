@@ -16,6 +16,7 @@
 #include "Board/Tools.h"
 #include "Board/PSFonts.h"
 #include <cmath>
+#include <algorithm>
 #include <cstring>
 #include <vector>
 #include <sstream>
@@ -32,6 +33,21 @@
 #endif
 
 namespace {
+/**
+ * Number of segments of a polygon approximating an arc within a
+ * tenth of a pixel.
+ *
+ * @param radius The radius of the arc, in pixels.
+ * @param angle The angle of the arc.
+ */
+unsigned int rasterArcSteps( double radius, double angle )
+{
+    unsigned int n = 4;
+    if ( radius > 0.1 )
+        n = std::max( n, static_cast<unsigned int>( ceil( fabs( angle ) / ( 2 * acos( 1.0 - 0.1 / radius ) ) ) ) );
+    return std::min( n, 1024u );
+}
+
 const char * xFigDashStylesPS[] = {
     " [] 0 sd ", // SolidStyle
     " [1 1] 0 sd ", // DashStyle
@@ -149,6 +165,12 @@ Shape::postscriptProperties() const
     return str.str();
 }
 
+void
+Shape::flushRaster( Raster & /* raster */,
+                    const TransformRaster & /* transform */ ) const
+{
+}
+
 #ifdef WITH_CAIRO
 void
 Shape::setCairoDashStyle(cairo_t *cr, LineStyle type) const
@@ -376,6 +398,15 @@ Dot::flushTikZ( std::ostream & stream,
   stream << "% FIXME: Dot::flushTikZ unimplemented" << std::endl;
 }
 
+void
+Dot::flushRaster( Raster & raster,
+                  const TransformRaster & transform ) const
+{
+    std::vector<Point> points( 1, Point( transform.mapX( _x ), transform.mapY( _y ) ) );
+    raster.strokePolyline( points, false, transform.mapWidth( _lineWidth ),
+                           _lineCap, _lineJoin, _penColor );
+}
+
 Rect
 Dot::boundingBox() const
 {
@@ -601,6 +632,17 @@ Line::flushTikZ( std::ostream & stream,
     << ");" << std::endl;
 }
 
+void
+Line::flushRaster( Raster & raster,
+                   const TransformRaster & transform ) const
+{
+    std::vector<Point> points;
+    points.push_back( Point( transform.mapX( _x1 ), transform.mapY( _y1 ) ) );
+    points.push_back( Point( transform.mapX( _x2 ), transform.mapY( _y2 ) ) );
+    raster.strokePolyline( points, false, transform.mapWidth( _lineWidth ),
+                           _lineCap, _lineJoin, _penColor );
+}
+
 Rect
 Line::boundingBox() const
 {
@@ -1011,6 +1053,38 @@ Arrow::flushTikZ( std::ostream & stream,
     << ");" << std::endl;
 }
 
+void
+Arrow::flushRaster( Raster & raster,
+                    const TransformRaster & transform ) const
+{
+    double dx = _x1 - _x2;
+    double dy = _y1 - _y2;
+    double norm = sqrt( dx*dx + dy*dy );
+    dx /= norm;
+    dy /= norm;
+    dx *= 10*_lineWidth;
+    dy *= 10*_lineWidth;
+    double ndx1 = dx*cos(0.3)-dy*sin(0.3);
+    double ndy1 = dx*sin(0.3)+dy*cos(0.3);
+    double ndx2 = dx*cos(-0.3)-dy*sin(-0.3);
+    double ndy2 = dx*sin(-0.3)+dy*cos(-0.3);
+    const double width = transform.mapWidth( _lineWidth );
+
+    std::vector<Point> points;
+    points.push_back( Point( transform.mapX( _x1 ), transform.mapY( _y1 ) ) );
+    points.push_back( Point( transform.mapX( _x2 + ( dx * cos(0.3) ) ),
+                             transform.mapY( _y2 + ( dy * cos(0.3) ) ) ) );
+    raster.strokePolyline( points, false, width, _lineCap, _lineJoin, _penColor );
+
+    points.clear();
+    points.push_back( Point( transform.mapX( _x2 + ndx1 ), transform.mapY( _y2 + ndy1 ) ) );
+    points.push_back( Point( transform.mapX( _x2 ), transform.mapY( _y2 ) ) );
+    points.push_back( Point( transform.mapX( _x2 + ndx2 ), transform.mapY( _y2 + ndy2 ) ) );
+    if ( filled() )
+        raster.fillPolygon( points, _penColor );
+    raster.strokePolyline( points, true, width, _lineCap, _lineJoin, _penColor );
+}
+
 /*
  * Ellipse
  */
@@ -1288,6 +1362,27 @@ Ellipse::flushTikZ( std::ostream & stream,
 	 << std::endl;
 }
 
+void
+Ellipse::flushRaster( Raster & raster,
+                      const TransformRaster & transform ) const
+{
+    const unsigned int n = rasterArcSteps( transform.scale( std::max( _xRadius, _yRadius ) ), 2 * M_PI );
+    const double c = cos( _angle );
+    const double s = sin( _angle );
+    std::vector<Point> points( n );
+    for ( unsigned int i = 0; i < n; ++i ) {
+        const double t = ( 2 * M_PI * i ) / n;
+        const double x = _xRadius * cos( t );
+        const double y = _yRadius * sin( t );
+        points[ i ] = Point( transform.mapX( _center.x + c * x - s * y ),
+                             transform.mapY( _center.y + s * x + c * y ) );
+    }
+    if ( filled() )
+        raster.fillPolygon( points, _fillColor );
+    raster.strokePolyline( points, true, transform.mapWidth( _lineWidth ),
+                           _lineCap, _lineJoin, _penColor );
+}
+
 Rect
 Ellipse::boundingBox() const
 {
@@ -1633,6 +1728,28 @@ Arc::flushTikZ( std::ostream & stream,
 	   << std::endl;
 }
 
+void
+Arc::flushRaster( Raster & raster,
+                  const TransformRaster & transform ) const
+{
+  // Counter-clockwise from a1 to a2, as in flushPostscript().
+  double a1 = _negative ? _angle2 : _angle1;
+  double a2 = _negative ? _angle1 : _angle2;
+  while ( a2 < a1 )
+    a2 += 2 * M_PI;
+  const unsigned int n = rasterArcSteps( transform.scale( _xRadius ), a2 - a1 );
+  std::vector<Point> points( n + 1 );
+  for ( unsigned int i = 0; i <= n; ++i ) {
+    const double t = a1 + ( ( a2 - a1 ) * i ) / n;
+    points[ i ] = Point( transform.mapX( _center.x + _xRadius * cos( t ) ),
+                         transform.mapY( _center.y + _xRadius * sin( t ) ) );
+  }
+  if ( filled() )
+    raster.fillPolygon( points, _fillColor );
+  raster.strokePolyline( points, false, transform.mapWidth( _lineWidth ),
+                         _lineCap, _lineJoin, _penColor );
+}
+
 /*
  * Polyline
  */
@@ -1864,6 +1981,20 @@ Polyline::flushTikZ( std::ostream & stream,
     stream << ";" << std::endl;
 }
 
+void
+Polyline::flushRaster( Raster & raster,
+                       const TransformRaster & transform ) const
+{
+    if ( _path.empty() )
+        return;
+    std::vector<Point> points;
+    _path.flushRasterPoints( points, transform );
+    if ( filled() )
+        raster.fillPolygon( points, _fillColor );
+    raster.strokePolyline( points, _path.closed(), transform.mapWidth( _lineWidth ),
+                           _lineCap, _lineJoin, _penColor );
+}
+
 Rect
 Polyline::boundingBox() const
 {
@@ -2335,6 +2466,35 @@ GouraudTriangle::flushTikZ( std::ostream & stream,
   stream << "% FIXME: GouraudTriangle::flushTikZ unimplemented" << std::endl;
 }
 
+void
+GouraudTriangle::flushRaster( Raster & raster,
+                              const TransformRaster & transform ) const
+{
+    if ( ! _subdivisions ) {
+        Polyline::flushRaster( raster, transform );
+        return;
+    }
+    const Point & p0 = _path[0];
+    const Point & p1 = _path[1];
+    const Point & p2 = _path[2];
+    Point p01( 0.5*(p0.x+p1.x), 0.5*(p0.y+p1.y) );
+    DGtal::Color c01( (_color0.red() + _color1.red())/2,
+               (_color0.green() + _color1.green())/2,
+               (_color0.blue() + _color1.blue())/2 );
+    Point p12( 0.5*(p1.x+p2.x), 0.5*(p1.y+p2.y) );
+    DGtal::Color c12( (_color1.red() + _color2.red())/2,
+               (_color1.green() + _color2.green())/2,
+               (_color1.blue() + _color2.blue())/2 );
+    Point p20( 0.5*(p2.x+p0.x), 0.5*(p2.y+p0.y) );
+    DGtal::Color c20( (_color2.red() + _color0.red())/2,
+               (_color2.green() + _color0.green())/2,
+               (_color2.blue() + _color0.blue())/2 );
+    GouraudTriangle( p0, _color0, p20, c20, p01, c01, _subdivisions - 1, _depth ).flushRaster( raster, transform );
+    GouraudTriangle( p1, _color1, p01, c01, p12, c12, _subdivisions - 1, _depth ).flushRaster( raster, transform );
+    GouraudTriangle( p2, _color2, p20, c20, p12, c12, _subdivisions - 1, _depth ).flushRaster( raster, transform );
+    GouraudTriangle( p01, c01, p12, c12, p20, c20,  _subdivisions - 1, _depth ).flushRaster( raster, transform );
+}
+
 /*
  * Triangle
  */
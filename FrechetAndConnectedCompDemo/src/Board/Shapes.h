@@ -18,6 +18,7 @@
 #include "Board/Rect.h"
 #include "Board/Path.h"
 #include "Board/Transforms.h"
+#include "Board/Raster.h"
 #include "Board/PSFonts.h"
 #include "Board/Tools.h"
 #include <string>
@@ -266,6 +267,16 @@ struct Shape {
   virtual void flushTikZ( std::ostream & stream,
        const TransformTikZ & transform ) const = 0;
 
+  /** 
+   * Draws the shape in a raster image according to a transform. The
+   * default implementation draws nothing (used by texts).
+   * 
+   * @param raster The raster image.
+   * @param transform A 2D transform to be applied.
+   */
+  virtual void flushRaster( Raster & raster,
+       const TransformRaster & transform ) const;
+
   inline int depth() const;
 
   virtual void depth( int );
@@ -502,6 +513,9 @@ struct Dot : public Shape {
   void flushTikZ( std::ostream & stream,
      const TransformTikZ & transform ) const;
 
+  void flushRaster( Raster & raster,
+     const TransformRaster & transform ) const;
+
   Rect boundingBox() const;
 
   Dot * clone() const;
@@ -625,6 +639,9 @@ struct Line : public Shape {
   void flushTikZ( std::ostream & stream,
      const TransformTikZ & transform ) const;
 
+  void flushRaster( Raster & raster,
+     const TransformRaster & transform ) const;
+
   Rect boundingBox() const;
 
   Line * clone() const;
@@ -733,6 +750,9 @@ struct Arrow : public Line {
   void flushTikZ( std::ostream & stream,
      const TransformTikZ & transform ) const;
 
+  void flushRaster( Raster & raster,
+     const TransformRaster & transform ) const;
+
   Arrow * clone() const;
 
 private:
@@ -875,6 +895,9 @@ struct Polyline : public Shape {
   void flushTikZ( std::ostream & stream,
      const TransformTikZ & transform ) const;
 
+  void flushRaster( Raster & raster,
+     const TransformRaster & transform ) const;
+
   Rect boundingBox() const;
 
   Polyline * clone() const;
@@ -1238,6 +1261,9 @@ struct GouraudTriangle : public Polyline {
   void flushTikZ( std::ostream & stream,
      const TransformTikZ & transform ) const;
 
+  void flushRaster( Raster & raster,
+     const TransformRaster & transform ) const;
+
   GouraudTriangle * clone() const;
 
 private:
@@ -1357,6 +1383,9 @@ struct Ellipse : public Shape {
   void flushTikZ( std::ostream & stream,
      const TransformTikZ & transform ) const;
 
+  void flushRaster( Raster & raster,
+     const TransformRaster & transform ) const;
+
   Rect boundingBox() const;
 
   Ellipse * clone() const;
@@ -1476,6 +1505,9 @@ struct Arc : public Circle {
   flushTikZ( std::ostream & stream,
 	     const TransformTikZ & transform ) const;
 
+  void flushRaster( Raster & raster,
+     const TransformRaster & transform ) const;
+
 private:
   static const std::string _name; /**< The generic name of the shape. */
   
@@ -219,6 +219,60 @@ TransformSVG::setBoundingBox( const Rect & rect,
   }
 }
 
+//
+// TransformRaster
+// 
+
+double
+TransformRaster::rounded( double x ) const
+{
+  return x;
+}
+
+double
+TransformRaster::mapY( double y ) const
+{
+  return _height - ( y * _scale + _deltaY );
+}
+
+double
+TransformRaster::mapWidth( double width ) const
+{
+  // Widths are given in Postscript points, as in the EPS output.
+  return width * _pixelsPerPoint;
+}
+
+void
+TransformRaster::setResolution( double dpi )
+{
+  _pixelsPerPoint = dpi / 72.0;
+}
+
+void
+TransformRaster::setBoundingBox( const Rect & rect,
+            const double pageWidth,
+            const double pageHeight,
+            const double margin )  
+{
+  // The scale of the EPS output, but the image is cropped to the
+  // bounding box of the drawing, as the EPS bounding box.
+  _scale = _pixelsPerPoint;
+  if ( pageWidth > 0 && pageHeight > 0 && rect.width > 0 && rect.height > 0 ) {
+    const double w = pageWidth - 2 * margin;
+    const double h = pageHeight - 2 * margin;
+    if ( ( rect.height / rect.width ) > ( h / w ) ) {
+      _scale *= h * ppmm / rect.height;
+    } else {
+      _scale *= w * ppmm / rect.width;
+    }
+  }
+  _deltaX = - _scale * rect.left;
+  _deltaY = - _scale * ( rect.top - rect.height );
+  _width = static_cast<unsigned int>( std::ceil( _scale * rect.width ) );
+  _pixelHeight = static_cast<unsigned int>( std::ceil( _scale * rect.height ) );
+  _height = _pixelHeight;
+}
+
 #ifdef WITH_CAIRO
 //
 // TransformCairo
@@ -121,6 +121,31 @@ public:
 };
 #endif
 
+/**
+ * The TransformRaster structure.
+ * @brief Structure representing a scaling and translation
+ * suitable for a raster output: the bounding box of the EPS output,
+ * seen at a given resolution, with pixel rows going down.
+ */
+struct TransformRaster : public Transform {
+public:
+  inline TransformRaster();
+  double rounded( double x ) const;
+  double mapY( double y ) const;
+  double mapWidth( double width ) const;
+  void setResolution( double dpi );
+  void setBoundingBox( const Rect & rect,
+           const double pageWidth,
+           const double pageHeight,
+           const double margin );
+  inline unsigned int width() const;
+  inline unsigned int height() const;
+private:
+  double _pixelsPerPoint;
+  unsigned int _width;
+  unsigned int _pixelHeight;
+};
+
 /**
  * The TransformTikZ structure.
  * @brief Structure representing a scaling and translation
@@ -59,6 +59,8 @@ namespace DGtal
 
   TraceWriterTerm traceWriterTerm(std::cerr);
   Trace trace(traceWriterTerm);
+  // after trace, which it may use until it is destroyed.
+  Profiler profiler;
 }
 //                                                                           //
 ///////////////////////////////////////////////////////////////////////////////
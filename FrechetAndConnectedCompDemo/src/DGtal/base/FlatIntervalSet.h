@@ -0,0 +1,244 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FlatIntervalSet.h
+ *
+ * @date 2026/10/17
+ *
+ * Header file for template class FlatIntervalSet
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(FlatIntervalSet_RECURSES)
+#error Recursive header files inclusion detected in FlatIntervalSet.h
+#else // defined(FlatIntervalSet_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FlatIntervalSet_RECURSES
+
+#if !defined FlatIntervalSet_h
+/** Prevents repeated inclusion of headers. */
+#define FlatIntervalSet_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FlatIntervalSet
+  /**
+     Description of template class 'FlatIntervalSet' <p>
+     \brief Aim: Stores a union of closed intervals [a,b] of an ordered
+     set as a sorted vector of pairwise disjoint intervals.
+
+     Inserting an interval merges it with all the intervals it
+     intersects, so that the stored intervals remain disjoint and
+     sorted. Membership is tested by binary search. Compared to a
+     node-based container like boost::icl::interval_set, the intervals
+     are contiguous in memory and a cleared set keeps its capacity,
+     which makes it well suited to small sets updated in inner loops.
+
+     Intervals are closed: [a,b] and [b,c] are merged into [a,c], but
+     [a,b] and [b+1,c] are not merged even for integer values. An
+     interval [a,b] with b < a is empty and is ignored.
+
+     @tparam TValue the type of the bounds, a model of
+     LessThanComparable (e.g. double).
+   */
+  template <typename TValue>
+  class FlatIntervalSet
+  {
+  public:
+    typedef TValue Value;
+    typedef FlatIntervalSet<Value> Self;
+    /// A closed interval [first,second].
+    typedef std::pair<Value,Value> Interval;
+    typedef std::vector<Interval> Container;
+    typedef typename Container::const_iterator ConstIterator;
+    typedef typename Container::size_type Size;
+
+    // ----------------------- std types ----------------------------------
+    typedef Interval value_type;
+    typedef Size size_type;
+    typedef ConstIterator const_iterator;
+    typedef ConstIterator iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor. The set is empty.
+    */
+    FlatIntervalSet();
+
+    /**
+     * Destructor.
+     */
+    ~FlatIntervalSet();
+
+    // ----------------------- Container services -----------------------------
+  public:
+
+    /**
+       @return the number of disjoint intervals.
+    */
+    Size size() const;
+
+    /**
+       @return 'true' if the set contains no interval.
+    */
+    bool empty() const;
+
+    /**
+       Removes all the intervals. The capacity is kept.
+    */
+    void clear();
+
+    /**
+       Requests that the capacity be at least enough to contain n intervals.
+       @param n a number of intervals.
+    */
+    void reserve( Size n );
+
+    /**
+       @return an iterator on the first interval (the leftmost one).
+    */
+    ConstIterator begin() const;
+
+    /**
+       @return an iterator after the last interval.
+    */
+    ConstIterator end() const;
+
+    /**
+       Inserts the closed interval [a,b] and merges it with the
+       intervals it intersects. Does nothing if b < a.
+
+       @param a the lower bound.
+       @param b the upper bound.
+       @return an iterator on the interval that contains [a,b] after
+       the insertion, or end() if [a,b] is empty.
+    */
+    ConstIterator insert( const Value & a, const Value & b );
+
+    /**
+       Inserts the closed interval s.
+       @param s an interval.
+       @return an iterator on the interval that contains s after the
+       insertion, or end() if s is empty.
+    */
+    ConstIterator insert( const Interval & s );
+
+    /**
+       Removes one of the stored intervals.
+       @param it a valid iterator on an interval of this set.
+       @return the iterator following the removed interval.
+    */
+    ConstIterator erase( ConstIterator it );
+
+    /**
+       @param x any value.
+       @return an iterator on the interval containing x, or end().
+    */
+    ConstIterator find( const Value & x ) const;
+
+    /**
+       @param x any value.
+       @return 'true' if some interval contains x.
+    */
+    bool contains( const Value & x ) const;
+
+    /**
+       @param s a closed interval.
+       @return the range of the stored intervals that intersect s,
+       i.e. the ones that would be merged by insert( s ).
+    */
+    std::pair<ConstIterator,ConstIterator> equal_range( const Interval & s ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the intervals are non empty, sorted and
+     * disjoint, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The sorted disjoint intervals.
+    Container myIntervals;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+       @param x any value.
+       @return the first interval whose upper bound is not smaller than x.
+    */
+    typename Container::iterator firstNotBefore( const Value & x );
+
+    /**
+       @param x any value.
+       @return the first interval whose upper bound is not smaller than x.
+    */
+    ConstIterator firstNotBefore( const Value & x ) const;
+
+  }; // end of class FlatIntervalSet
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FlatIntervalSet'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FlatIntervalSet' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const FlatIntervalSet<TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/FlatIntervalSet.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FlatIntervalSet_h
+
+#undef FlatIntervalSet_RECURSES
+#endif // else defined(FlatIntervalSet_RECURSES)
@@ -0,0 +1,258 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FlatMap.h
+ *
+ * @date 2026/10/17
+ *
+ * Header file for template class FlatMap
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(FlatMap_RECURSES)
+#error Recursive header files inclusion detected in FlatMap.h
+#else // defined(FlatMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FlatMap_RECURSES
+
+#if !defined FlatMap_h
+/** Prevents repeated inclusion of headers. */
+#define FlatMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <functional>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FlatMap
+  /**
+     Description of template class 'FlatMap' <p>
+     \brief Aim: An associative container with the interface of a
+     subset of std::map, storing its (key,value) pairs in a vector
+     sorted by key.
+
+     Lookups are binary searches on contiguous memory. Insertion and
+     erasure are linear in the worst case, but constant when they
+     occur at the end of the map, and a cleared map keeps its
+     capacity. It is therefore well suited to small maps that are
+     mostly filled in key order, like the occulters of a
+     FrechetShortcut.
+
+     Contrary to std::map, inserting or erasing an element invalidates
+     the iterators that follow it, and the key of an element must not
+     be modified through an iterator.
+
+     @tparam TKey the type of the keys.
+     @tparam TValue the type of the mapped values.
+     @tparam TCompare the strict weak ordering on the keys.
+   */
+  template < typename TKey, typename TValue,
+             typename TCompare = std::less<TKey> >
+  class FlatMap
+  {
+  public:
+    typedef TKey Key;
+    typedef TValue Value;
+    typedef TCompare Compare;
+    typedef FlatMap<Key,Value,Compare> Self;
+    typedef std::pair<Key,Value> Pair;
+    typedef std::vector<Pair> Container;
+    typedef typename Container::iterator Iterator;
+    typedef typename Container::const_iterator ConstIterator;
+    typedef typename Container::size_type Size;
+
+    // ----------------------- std types ----------------------------------
+    typedef Key key_type;
+    typedef Value mapped_type;
+    typedef Pair value_type;
+    typedef Size size_type;
+    typedef Iterator iterator;
+    typedef ConstIterator const_iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor. The map is empty.
+       @param comp the ordering on the keys.
+    */
+    FlatMap( const Compare & comp = Compare() );
+
+    /**
+     * Destructor.
+     */
+    ~FlatMap();
+
+    // ----------------------- Container services -----------------------------
+  public:
+
+    /// @return the number of elements.
+    Size size() const;
+
+    /// @return 'true' if the map is empty.
+    bool empty() const;
+
+    /// Removes all the elements. The capacity is kept.
+    void clear();
+
+    /**
+       Removes all the elements and changes the ordering of the keys.
+       The capacity is kept.
+       @param comp the new ordering on the keys.
+    */
+    void clear( const Compare & comp );
+
+    /**
+       Requests that the capacity be at least enough to contain n elements.
+       @param n a number of elements.
+    */
+    void reserve( Size n );
+
+    /// @return an iterator on the element with the smallest key.
+    Iterator begin();
+    /// @return an iterator after the last element.
+    Iterator end();
+    /// @return an iterator on the element with the smallest key.
+    ConstIterator begin() const;
+    /// @return an iterator after the last element.
+    ConstIterator end() const;
+
+    /**
+       @param k any key.
+       @return an iterator on the first element whose key is not less than k.
+    */
+    Iterator lower_bound( const Key & k );
+
+    /**
+       @param k any key.
+       @return an iterator on the first element whose key is not less than k.
+    */
+    ConstIterator lower_bound( const Key & k ) const;
+
+    /**
+       @param k any key.
+       @return an iterator on the element of key k, or end().
+    */
+    Iterator find( const Key & k );
+
+    /**
+       @param k any key.
+       @return an iterator on the element of key k, or end().
+    */
+    ConstIterator find( const Key & k ) const;
+
+    /**
+       Inserts v if there is no element with the key v.first.
+       @param v a (key,value) pair.
+       @return an iterator on the element with key v.first and 'true'
+       if v was inserted.
+    */
+    std::pair<Iterator,bool> insert( const Pair & v );
+
+    /**
+       Inserts v if there is no element with the key v.first. The
+       insertion is done in constant time if v should be placed just
+       before hint (e.g. hint is end() and v.first is the greatest key).
+       @param hint an iterator on this map.
+       @param v a (key,value) pair.
+       @return an iterator on the element with key v.first.
+    */
+    Iterator insert( Iterator hint, const Pair & v );
+
+    /**
+       Removes an element.
+       @param it a valid iterator on an element of this map.
+       @return the iterator following the removed element.
+    */
+    Iterator erase( Iterator it );
+
+    /**
+       Removes the element of key k, if any.
+       @param k any key.
+       @return the number of removed elements (0 or 1).
+    */
+    Size erase( const Key & k );
+
+    /**
+       @param k any key.
+       @return a reference on the value associated to k, inserting a
+       default one if there was none.
+    */
+    Value & operator[]( const Key & k );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the keys are strictly increasing, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The ordering on the keys.
+    Compare myCompare;
+
+    /// The (key,value) pairs sorted by key.
+    Container myData;
+
+  }; // end of class FlatMap
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FlatMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FlatMap' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKey, typename TValue, typename TCompare>
+  std::ostream&
+  operator<< ( std::ostream & out, const FlatMap<TKey,TValue,TCompare> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/FlatMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FlatMap_h
+
+#undef FlatMap_RECURSES
+#endif // else defined(FlatMap_RECURSES)
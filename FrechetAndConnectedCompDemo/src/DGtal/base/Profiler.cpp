@@ -0,0 +1,351 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file Profiler.cpp
+ *
+ * @date 2026/10/17
+ *
+ * Implementation of methods defined in Profiler.h
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Profiler.h"
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <algorithm>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+
+using namespace std;
+
+namespace
+{
+  /**
+   * Writes a string in JSON, between quotes.
+   */
+  void writeJSONString( std::ostream & out, const std::string & s )
+  {
+    out << '"';
+    for ( std::string::const_iterator it = s.begin(); it != s.end(); ++it )
+      {
+        unsigned char c = (unsigned char) *it;
+        if ( c == '"' || c == '\\' )
+          out << '\\' << *it;
+        else if ( c < 0x20 )
+          {
+            const char * digits = "0123456789abcdef";
+            out << "\\u00" << digits[ c >> 4 ] << digits[ c & 15 ];
+          }
+        else
+          out << *it;
+      }
+    out << '"';
+  }
+
+  /**
+   * Writes a string as a CSV field, between quotes if needed.
+   */
+  void writeCSVField( std::ostream & out, const std::string & s )
+  {
+    if ( s.find_first_of( ",\"\n\r" ) == std::string::npos )
+      {
+        out << s;
+        return;
+      }
+    out << '"';
+    for ( std::string::const_iterator it = s.begin(); it != s.end(); ++it )
+      {
+        if ( *it == '"' ) out << '"';
+        out << *it;
+      }
+    out << '"';
+  }
+
+  /**
+   * @return the nearest-rank percentile of sorted values.
+   */
+  double percentile( const std::vector<double> & sorted, double p )
+  {
+    std::size_t rank = (std::size_t) std::ceil( p / 100.0 * sorted.size() );
+    return sorted[ rank > 0 ? rank - 1 : 0 ];
+  }
+
+  /**
+   * Orders the statistics by decreasing total time.
+   */
+  bool spendsMore( const DGtal::Profiler::ZoneStatistics & a,
+                   const DGtal::Profiler::ZoneStatistics & b )
+  {
+    return a.total > b.total || ( a.total == b.total && a.name < b.name );
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// class Profiler
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+DGtal::Profiler::Profiler()
+  : myEnabled( false ), myCountAllocations( false )
+{
+  const char * fileName = getenv( "DGTAL_PROFILE" );
+  if ( fileName != 0 && *fileName != '\0' )
+    enable( fileName );
+  const char * allocations = getenv( "DGTAL_PROFILE_ALLOCATIONS" );
+  if ( allocations != 0 && *allocations != '\0' && strcmp( allocations, "0" ) != 0 )
+    myCountAllocations = true;
+}
+
+DGtal::Profiler::~Profiler()
+{
+  myEnabled = false;
+  myCountAllocations = false;
+  if ( ! myFileName.empty() )
+    write( myFileName );
+}
+
+void
+DGtal::Profiler::enable( const std::string & fileName )
+{
+  myEnabled = false;
+  myThreads.clear();
+  myThreads.resize( MaxThreads );
+  for ( unsigned int i = 0; i < MaxThreads; ++i )
+    {
+      myThreads[ i ].allocations = 0;
+      myThreads[ i ].allocatedBytes = 0;
+    }
+  myFileName = fileName;
+  myClock.startClock();
+  myEnabled = true;
+}
+
+void
+DGtal::Profiler::clear()
+{
+  for ( unsigned int i = 0; i < myThreads.size(); ++i )
+    {
+      myThreads[ i ].open.clear();
+      myThreads[ i ].recorded.clear();
+    }
+}
+
+DGtal::Profiler::ThreadZones *
+DGtal::Profiler::threadZones()
+{
+#ifdef WITH_OPENMP
+  unsigned int thread = (unsigned int) omp_get_thread_num();
+#else
+  unsigned int thread = 0;
+#endif
+  return thread < myThreads.size() ? &myThreads[ thread ] : 0;
+}
+
+void
+DGtal::Profiler::beginZone( const std::string & name )
+{
+  if ( ! myEnabled ) return;
+  ThreadZones * zones = threadZones();
+  if ( zones == 0 ) return;
+  // The allocations of the profiler itself are not counted.
+  unsigned long allocations = zones->allocations;
+  unsigned long long allocatedBytes = zones->allocatedBytes;
+  zones->open.push_back( Zone() );
+  Zone & zone = zones->open.back();
+  zone.name = name;
+  zone.depth = (unsigned int) zones->open.size() - 1;
+  zone.allocations = allocations;
+  zone.allocatedBytes = allocatedBytes;
+  zones->allocations = allocations;
+  zones->allocatedBytes = allocatedBytes;
+  zone.start = myClock.stopClock();
+}
+
+void
+DGtal::Profiler::endZone()
+{
+  if ( ! myEnabled ) return;
+  double end = myClock.stopClock();
+  ThreadZones * zones = threadZones();
+  if ( zones == 0 || zones->open.empty() ) return;
+  unsigned long allocations = zones->allocations;
+  unsigned long long allocatedBytes = zones->allocatedBytes;
+  Zone & zone = zones->open.back();
+  zone.duration = end - zone.start;
+  zone.allocations = allocations - zone.allocations;
+  zone.allocatedBytes = allocatedBytes - zone.allocatedBytes;
+  zones->recorded.push_back( Zone() );
+  std::swap( zones->recorded.back(), zone );
+  zones->open.pop_back();
+  zones->allocations = allocations;
+  zones->allocatedBytes = allocatedBytes;
+}
+
+void
+DGtal::Profiler::recordAllocation( std::size_t size )
+{
+  // profiler is zero-initialized, hence disabled, before its construction.
+  if ( ! profiler.myEnabled || ! profiler.myCountAllocations ) return;
+  ThreadZones * zones = profiler.threadZones();
+  if ( zones == 0 ) return;
+  ++zones->allocations;
+  zones->allocatedBytes += size;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Interface - public :
+
+unsigned long
+DGtal::Profiler::size() const
+{
+  unsigned long n = 0;
+  for ( unsigned int i = 0; i < myThreads.size(); ++i )
+    n += (unsigned long) myThreads[ i ].recorded.size();
+  return n;
+}
+
+std::vector<DGtal::Profiler::ZoneStatistics>
+DGtal::Profiler::statistics() const
+{
+  typedef std::map<std::string, std::pair< std::vector<double>, ZoneStatistics > > Groups;
+  Groups groups;
+  for ( unsigned int i = 0; i < myThreads.size(); ++i )
+    for ( std::vector<Zone>::const_iterator it = myThreads[ i ].recorded.begin(),
+            itEnd = myThreads[ i ].recorded.end(); it != itEnd; ++it )
+      {
+        Groups::iterator group = groups.find( it->name );
+        if ( group == groups.end() )
+          {
+            group = groups.insert( std::make_pair( it->name, Groups::mapped_type() ) ).first;
+            group->second.second.allocations = 0;
+            group->second.second.allocatedBytes = 0;
+          }
+        group->second.first.push_back( it->duration );
+        group->second.second.allocations += it->allocations;
+        group->second.second.allocatedBytes += it->allocatedBytes;
+      }
+
+  std::vector<ZoneStatistics> result;
+  for ( Groups::iterator group = groups.begin(); group != groups.end(); ++group )
+    {
+      std::vector<double> & durations = group->second.first;
+      std::sort( durations.begin(), durations.end() );
+      ZoneStatistics s = group->second.second;
+      s.name = group->first;
+      s.count = (unsigned long) durations.size();
+      s.total = 0.0;
+      for ( std::size_t k = 0; k < durations.size(); ++k )
+        s.total += durations[ k ];
+      s.min = durations.front();
+      s.max = durations.back();
+      s.mean = s.total / s.count;
+      s.p50 = percentile( durations, 50.0 );
+      s.p90 = percentile( durations, 90.0 );
+      s.p99 = percentile( durations, 99.0 );
+      result.push_back( s );
+    }
+  std::sort( result.begin(), result.end(), spendsMore );
+  return result;
+}
+
+void
+DGtal::Profiler::writeChromeTrace( std::ostream & out ) const
+{
+  std::streamsize precision = out.precision( 3 );
+  std::ios_base::fmtflags flags = out.setf( std::ios_base::fixed, std::ios_base::floatfield );
+  out << "{\"traceEvents\":[";
+  bool first = true;
+  for ( unsigned int i = 0; i < myThreads.size(); ++i )
+    for ( std::vector<Zone>::const_iterator it = myThreads[ i ].recorded.begin(),
+            itEnd = myThreads[ i ].recorded.end(); it != itEnd; ++it )
+      {
+        out << ( first ? "\n" : ",\n" ) << "{\"name\":";
+        writeJSONString( out, it->name );
+        out << ",\"cat\":\"DGtal\",\"ph\":\"X\",\"ts\":" << 1000.0 * it->start
+            << ",\"dur\":" << 1000.0 * it->duration
+            << ",\"pid\":1,\"tid\":" << i
+            << ",\"args\":{\"depth\":" << it->depth
+            << ",\"allocations\":" << it->allocations
+            << ",\"allocatedBytes\":" << it->allocatedBytes << "}}";
+        first = false;
+      }
+  out << "\n],\"displayTimeUnit\":\"ms\"}" << std::endl;
+  out.precision( precision );
+  out.flags( flags );
+}
+
+void
+DGtal::Profiler::writeCSV( std::ostream & out ) const
+{
+  std::vector<ZoneStatistics> stats = statistics();
+  out << "name,count,total_ms,min_ms,max_ms,mean_ms,p50_ms,p90_ms,p99_ms,allocations,allocated_bytes"
+      << std::endl;
+  for ( std::vector<ZoneStatistics>::const_iterator it = stats.begin(), itEnd = stats.end();
+        it != itEnd; ++it )
+    {
+      writeCSVField( out, it->name );
+      out << "," << it->count << "," << it->total << "," << it->min << "," << it->max
+          << "," << it->mean << "," << it->p50 << "," << it->p90 << "," << it->p99
+          << "," << it->allocations << "," << it->allocatedBytes << std::endl;
+    }
+}
+
+bool
+DGtal::Profiler::write( const std::string & fileName ) const
+{
+  std::ofstream out( fileName.c_str() );
+  if ( ! out )
+    {
+      trace.error() << "[Profiler::write] cannot write the profile in " << fileName << std::endl;
+      return false;
+    }
+  if ( fileName.size() >= 5 && fileName.compare( fileName.size() - 5, 5, ".json" ) == 0 )
+    writeChromeTrace( out );
+  else
+    writeCSV( out );
+  return ! out.fail();
+}
+
+void
+DGtal::Profiler::selfDisplay( std::ostream & out ) const
+{
+  out << "[Profiler " << ( myEnabled ? "enabled" : "disabled" )
+      << " zones=" << size();
+  if ( myCountAllocations ) out << " allocations";
+  if ( ! myFileName.empty() ) out << " file=" << myFileName;
+  out << "]";
+}
+
+bool
+DGtal::Profiler::isValid() const
+{
+  return true;
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,376 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file Profiler.h
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module Profiler.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(Profiler_RECURSES)
+#error Recursive header files inclusion detected in Profiler.h
+#else // defined(Profiler_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define Profiler_RECURSES
+
+#if !defined Profiler_h
+/** Prevents repeated inclusion of headers. */
+#define Profiler_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include "DGtal/base/Clock.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class Profiler
+  /**
+   * Description of class 'Profiler' <p>
+   * \brief Aim: Records the nested zones of a program (their duration
+   * and, optionally, their memory allocations) to locate its hot spots.
+   *
+   * A zone is opened by beginZone() and closed by endZone(), or by a
+   * ProfileZone object for the duration of a scope. The blocks of
+   * Trace::beginBlock() and Trace::endBlock() are zones as well, so
+   * that a program that already traces its steps is profiled without
+   * any change.
+   *
+   * The profiler does nothing until it is enabled, either by enable()
+   * or by setting the environment variable DGTAL_PROFILE to a file
+   * name before the program starts. In the latter case, the report is
+   * written in this file when the program exits:
+   * - a file name ending with ".json" receives all the zones in the
+   *   Chrome trace event format (see writeChromeTrace()), which can be
+   *   loaded in chrome://tracing or in Perfetto;
+   * - any other file receives the statistics of the zones grouped by
+   *   name, in CSV format (see writeCSV()).
+   *
+   * Zones may be opened by several threads: each OpenMP thread (when
+   * DGtal is built WITH_OPENMP) has its own stack of zones, and the
+   * zones of a thread are recorded without locking.
+   *
+   * When DGTAL_PROFILE_ALLOCATIONS is set as well (or after
+   * countAllocations(true)), the zones also record the number and the
+   * total size of the allocations done by their thread while they are
+   * open. This needs the program to include
+   * "DGtal/base/ProfilerAllocations.h" in exactly one of its source
+   * files, which replaces the global operators new and delete.
+   *
+   * @code
+   * DGtal::profiler.enable();
+   * {
+   *   DGtal::ProfileZone zone( "segmentation" );
+   *   ...
+   * }
+   * DGtal::profiler.writeCSV( std::cout );
+   * @endcode
+   *
+   * @see testProfiler.cpp
+   */
+  class Profiler
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Statistics of all the zones with the same name. The durations
+     * are in milliseconds and the percentiles are the nearest-rank
+     * ones.
+     */
+    struct ZoneStatistics
+    {
+      std::string name;
+      unsigned long count;
+      double total, min, max, mean, p50, p90, p99;
+      unsigned long allocations;
+      unsigned long long allocatedBytes;
+    };
+
+    /**
+     * Maximal number of threads whose zones are recorded: the zones
+     * opened by the threads of higher number are ignored.
+     */
+    static const unsigned int MaxThreads = 256;
+
+    /**
+     * Constructor. Enables the profiler when the environment variable
+     * DGTAL_PROFILE is set.
+     */
+    Profiler();
+
+    /**
+     * Destructor. Writes the report in the file given by DGTAL_PROFILE,
+     * if any.
+     */
+    ~Profiler();
+
+    /**
+     * Clears the recorded zones and starts recording.
+     *
+     * @param fileName if not empty, the report is written in this file
+     * when the profiler is destroyed (see write()).
+     */
+    void enable( const std::string & fileName = "" );
+
+    /**
+     * Stops recording. The recorded zones are kept.
+     */
+    void disable();
+
+    /**
+     * @return 'true' if the zones are recorded.
+     */
+    bool isEnabled() const;
+
+    /**
+     * Starts or stops counting the allocations in the zones (see
+     * ProfilerAllocations.h).
+     *
+     * @param count 'true' to count them.
+     */
+    void countAllocations( bool count );
+
+    /**
+     * Forgets all the recorded zones.
+     */
+    void clear();
+
+    /**
+     * Opens a zone in the calling thread. Nothing is done if the
+     * profiler is disabled.
+     *
+     * @param name the name of the zone.
+     */
+    void beginZone( const std::string & name );
+
+    /**
+     * Closes the last zone opened by the calling thread and records it.
+     */
+    void endZone();
+
+    /**
+     * Counts an allocation in the zones of the calling thread. Called
+     * by the operators new of ProfilerAllocations.h.
+     *
+     * @param size the size of the allocation in bytes.
+     */
+    static void recordAllocation( std::size_t size );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the number of recorded zones.
+     */
+    unsigned long size() const;
+
+    /**
+     * @return the statistics of the recorded zones, grouped by name,
+     * by decreasing total time.
+     */
+    std::vector<ZoneStatistics> statistics() const;
+
+    /**
+     * Writes the recorded zones in the Chrome trace event format: one
+     * complete event ("ph":"X") per zone, with timestamps in
+     * microseconds since enable(), the thread number as "tid" and the
+     * allocations as arguments.
+     *
+     * @param out the output stream.
+     */
+    void writeChromeTrace( std::ostream & out ) const;
+
+    /**
+     * Writes the statistics() in CSV format, one line per name,
+     * after a header line.
+     *
+     * @param out the output stream.
+     */
+    void writeCSV( std::ostream & out ) const;
+
+    /**
+     * Writes the report in a file: Chrome trace if its name ends with
+     * ".json", CSV otherwise.
+     *
+     * @param fileName the name of the file.
+     * @return 'true' if the file was written.
+     */
+    bool write( const std::string & fileName ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /**
+     * A zone, open or recorded.
+     */
+    struct Zone
+    {
+      std::string name;
+      unsigned int depth;
+      double start, duration;
+      unsigned long allocations;
+      unsigned long long allocatedBytes;
+    };
+
+    /**
+     * The zones of one thread, and the allocations it has done since
+     * the profiler was enabled.
+     */
+    struct ThreadZones
+    {
+      std::vector<Zone> open;
+      std::vector<Zone> recorded;
+      unsigned long allocations;
+      unsigned long long allocatedBytes;
+    };
+
+    /// True when the zones are recorded.
+    bool myEnabled;
+    /// True when the allocations are counted.
+    bool myCountAllocations;
+    /// The file written by the destructor, if not empty.
+    std::string myFileName;
+    /// Started by enable(): the origin of the timestamps.
+    Clock myClock;
+    /// The zones of each thread, indexed by thread number.
+    std::vector<ThreadZones> myThreads;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    Profiler( const Profiler & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    Profiler & operator=( const Profiler & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @return the zones of the calling thread, or 0 if it is not
+     * recorded.
+     */
+    ThreadZones * threadZones();
+
+  }; // end of class Profiler
+
+  /**
+   * The profiler of the program (defined with DGtal::trace).
+   */
+  extern Profiler profiler;
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class ProfileZone
+  /**
+   * Description of class 'ProfileZone' <p>
+   * \brief Aim: A zone of the profiler open from the construction of
+   * the object to its destruction (or to end()).
+   *
+   * It also measures its own duration, even when the profiler is
+   * disabled, so that it can replace a Clock.
+   */
+  class ProfileZone
+  {
+  public:
+
+    /**
+     * Constructor. Opens the zone.
+     *
+     * @param name the name of the zone.
+     * @param aProfiler the profiler that records it.
+     */
+    ProfileZone( const std::string & name, Profiler & aProfiler = profiler );
+
+    /**
+     * Destructor. Closes the zone if end() was not called.
+     */
+    ~ProfileZone();
+
+    /**
+     * Closes the zone.
+     *
+     * @return its duration in milliseconds.
+     */
+    double end();
+
+  private:
+    Profiler & myProfiler;
+    Clock myClock;
+    bool myRecorded;
+    bool myOpen;
+
+    ProfileZone( const ProfileZone & other );
+    ProfileZone & operator=( const ProfileZone & other );
+  }; // end of class ProfileZone
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'Profiler'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'Profiler' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const Profiler & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/Profiler.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined Profiler_h
+
+#undef Profiler_RECURSES
+#endif // else defined(Profiler_RECURSES)
@@ -0,0 +1,95 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file ProfilerAllocations.h
+ *
+ * @date 2026/10/17
+ *
+ * Replacement of the global operators new and delete that counts the
+ * allocations in the zones of DGtal::profiler.
+ *
+ * The operators are defined, not declared: this file must be included
+ * in exactly one source file of a program (usually the one of main).
+ * The allocations are then counted when the profiler is enabled and
+ * DGTAL_PROFILE_ALLOCATIONS is set (or after
+ * Profiler::countAllocations(true)); otherwise the cost is one test
+ * per allocation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ProfilerAllocations_RECURSES)
+#error Recursive header files inclusion detected in ProfilerAllocations.h
+#else // defined(ProfilerAllocations_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ProfilerAllocations_RECURSES
+
+#if !defined ProfilerAllocations_h
+/** Prevents repeated inclusion of headers. */
+#define ProfilerAllocations_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <cstdlib>
+#include <new>
+#include "DGtal/base/Profiler.h"
+//////////////////////////////////////////////////////////////////////////////
+
+// Dynamic exception specifications are not allowed since C++17.
+#if __cplusplus >= 201103L
+#define DGTAL_PROFILER_THROW_BAD_ALLOC
+#define DGTAL_PROFILER_NOTHROW noexcept
+#else
+#define DGTAL_PROFILER_THROW_BAD_ALLOC throw( std::bad_alloc )
+#define DGTAL_PROFILER_NOTHROW throw()
+#endif
+
+void * operator new( std::size_t size ) DGTAL_PROFILER_THROW_BAD_ALLOC
+{
+  DGtal::Profiler::recordAllocation( size );
+  void * p = std::malloc( size > 0 ? size : 1 );
+  if ( p == 0 )
+    throw std::bad_alloc();
+  return p;
+}
+
+void * operator new[]( std::size_t size ) DGTAL_PROFILER_THROW_BAD_ALLOC
+{
+  DGtal::Profiler::recordAllocation( size );
+  void * p = std::malloc( size > 0 ? size : 1 );
+  if ( p == 0 )
+    throw std::bad_alloc();
+  return p;
+}
+
+void operator delete( void * p ) DGTAL_PROFILER_NOTHROW
+{
+  std::free( p );
+}
+
+void operator delete[]( void * p ) DGTAL_PROFILER_NOTHROW
+{
+  std::free( p );
+}
+
+#undef DGTAL_PROFILER_THROW_BAD_ALLOC
+#undef DGTAL_PROFILER_NOTHROW
+
+#endif // !defined ProfilerAllocations_h
+
+#undef ProfilerAllocations_RECURSES
+#endif // else defined(ProfilerAllocations_RECURSES)
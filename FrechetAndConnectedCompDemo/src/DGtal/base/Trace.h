@@ -46,6 +46,7 @@
 
 #include "DGtal/base/Config.h"
 #include "DGtal/base/Clock.h"
+#include "DGtal/base/Profiler.h"
 #include "DGtal/base/Assert.h"
 #include "DGtal/base/TraceWriter.h"
 #include "DGtal/base/TraceWriterTerm.h"
@@ -64,6 +65,9 @@ namespace DGtal
    * Trace objects use a TraceWriter to switch between terminal and file outputs.
    * Methods postfixed with "Debug" contain no code if the compilation flag DEBUG is not set.
    *
+   * When DGtal::profiler is enabled, each block is also recorded as a
+   * zone of the profiler (see Profiler).
+   *
    *
    * For usage examples, see the testtrace.cpp file.
    *
@@ -189,6 +193,9 @@ namespace DGtal
     ///A stack to store the block clocks
     std::stack<Clock*> myClockStack;
 
+    ///A stack to store whether the blocks are zones of the profiler
+    std::stack<bool> myProfiledStack;
+
     ///Progress bar current position
     unsigned int myProgressBarCurrent;
 
@@ -45,8 +45,12 @@
 #include "DGtal/base/ConceptUtils.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/arithmetic/IntegerComputer.h"
-#include <boost/icl/interval_set.hpp>
-#include <map>
+#include "DGtal/base/FlatIntervalSet.h"
+#include "DGtal/base/FlatMap.h"
+#include <vector>
+#include <limits>
+#include <boost/mpl/if.hpp>
+#include <boost/type_traits/is_same.hpp>
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -56,6 +60,21 @@
 
 namespace DGtal
 {
+
+  /**
+     Cone policy of FrechetShortcut (default): the bounds of the cone
+     used to test the width are angles, computed in floating-point
+     arithmetic (see FrechetShortcut::Cone).
+  */
+  struct FrechetAngularCone {};
+
+  /**
+     Cone policy of FrechetShortcut: the cone used to test the width is
+     given by the digital points that bound it, and the directions are
+     compared to them with integer arithmetic only (see
+     FrechetShortcut::ExactCone).
+  */
+  struct FrechetExactCone {};
   
   /////////////////////////////////////////////////////////////////////////////
   // class FrechetShortcut
@@ -98,7 +117,10 @@ namespace DGtal
    * @snippet geometry/curves/exampleFrechetShortcut.cpp FrechetShortcutUsage
    *
    *@tparam TIterator Iterator type on 2D digital points, TInteger type
-   *of integer  
+   *of integer, TConePolicy the computation of the width:
+   *FrechetAngularCone (default) or FrechetExactCone, which tests the
+   *width with integer arithmetic only (the backpaths still use
+   *angles).
    *
    *@see exampleFrechetShortcut.cpp testFrechetShortcut.cpp
    *
@@ -106,7 +128,7 @@ namespace DGtal
   
 
   
-  template <typename TIterator,typename TInteger = typename IteratorCirculatorTraits<TIterator>::Value::Coordinate>
+  template <typename TIterator,typename TInteger = typename IteratorCirculatorTraits<TIterator>::Value::Coordinate,typename TConePolicy = FrechetAngularCone>
     class FrechetShortcut
     {
       // ----------------------- Standard services ------------------------------
@@ -116,19 +138,48 @@ namespace DGtal
     
     BOOST_CONCEPT_ASSERT(( CInteger<TInteger> ) );
     typedef TInteger Integer;
+    typedef TConePolicy ConePolicy;
     
     
     
     //required types
     typedef TIterator ConstIterator;
-    typedef FrechetShortcut<ConstIterator,Integer> Self; 
-    typedef FrechetShortcut<std::reverse_iterator<ConstIterator>,Integer> Reverse;
+    typedef FrechetShortcut<ConstIterator,Integer,ConePolicy> Self; 
+    typedef FrechetShortcut<std::reverse_iterator<ConstIterator>,Integer,ConePolicy> Reverse;
     
     //2D point and 2D vector
     typedef typename IteratorCirculatorTraits<ConstIterator>::Value Point; 
     typedef typename IteratorCirculatorTraits<ConstIterator>::Value Vector; 
     typedef typename Vector::Coordinate Coordinate;
     
+    /**
+     Ordering of the occulters of a backpath: the order of the scan
+     from the back of the shortcut. It is the order of the iterators,
+     but circulators, which cannot be compared with operator<, are
+     compared by their distance from the back of the shortcut.
+    */
+    struct ScanOrder
+    {
+      /// The back of the shortcut (used for circulators only).
+      ConstIterator origin;
+
+      ScanOrder() {}
+      ScanOrder(const ConstIterator & it): origin(it) {}
+
+      bool operator()(const ConstIterator & a, const ConstIterator & b) const
+      {
+	return less(a, b, typename IteratorCirculatorTraits<ConstIterator>::Type());
+      }
+      bool less(const ConstIterator & a, const ConstIterator & b, IteratorType) const
+      {
+	return a < b;
+      }
+      bool less(const ConstIterator & a, const ConstIterator & b, CirculatorType) const
+      {
+	return (a - origin) < (b - origin);
+      }
+    };
+    
     /**
      Class backpath: data structures and methods to handle the backpath
      update
@@ -139,7 +190,7 @@ namespace DGtal
     /**
      * Pointer to the FrechetShortcut
      */
-    const FrechetShortcut<ConstIterator,Integer> *myS;
+    const FrechetShortcut<ConstIterator,Integer,ConePolicy> *myS;
     
   protected: 
     
@@ -154,20 +205,53 @@ namespace DGtal
     
     /**
        Map between the point and their attributes if they are
-       occulters 
+       occulters. Occulters are mostly inserted in increasing order,
+       hence a flat map.
     */
-    typedef std::map <ConstIterator,occulter_attributes > occulter_list;
+    typedef FlatMap <ConstIterator,occulter_attributes,ScanOrder > occulter_list;
     
   public:
-    friend class FrechetShortcut<ConstIterator,Integer>;
+    friend class FrechetShortcut<ConstIterator,Integer,ConePolicy>;
     
     
   public:
     
-    typedef boost::icl::interval_set<double> IntervalSet;
-    
-      /** 
-	  Octant of work 
+    typedef FlatIntervalSet<double> IntervalSet;
+    typedef IntervalSet::Interval Interval;
+
+  protected:
+
+    /**
+       Kind of modification recorded in the undo journal
+    */
+    enum JournalTag { FLAG_CHANGED, OCCULTER_ERASED, OCCULTER_INSERTED,
+		      OCCULTER_MODIFIED, INTERVAL_INSERTED };
+
+    /**
+       Entry of the undo journal: enough information to revert one
+       elementary modification of the backpath
+    */
+    struct JournalEntry
+    {
+      JournalTag tag;
+      // FLAG_CHANGED: previous values of myFlag and myIt
+      bool flag;
+      ConstIterator it;
+      // OCCULTER_*: key and previous attributes of the occulter
+      ConstIterator key;
+      occulter_attributes attributes;
+      // INTERVAL_INSERTED: interval obtained after the insertion and
+      // range [first,last) of the absorbed intervals in
+      // myJournalIntervals
+      Interval interval;
+      std::size_t first;
+      std::size_t last;
+    };
+
+  public:
+
+      /**
+	  Octant of work
       */
       int myQuad; 
       
@@ -188,10 +272,27 @@ namespace DGtal
       /** 
 	  pointer to the next point to be scanned: set to myEnd + 1 
        */
-      ConstIterator myIt; 
-      
-      /** 
-	  Default constructor 
+      ConstIterator myIt;
+
+      /**
+	 True if the modifications are recorded in the undo journal
+      */
+      bool myJournaling;
+
+      /**
+	 Undo journal: modifications performed since the last call to
+	 beginJournal(). Its capacity is kept between two transactions
+	 so that a speculative update does not allocate once warm.
+      */
+      std::vector<JournalEntry> myJournal;
+
+      /**
+	 Intervals absorbed by the insertions recorded in myJournal
+      */
+      std::vector<Interval> myJournalIntervals;
+
+      /**
+	  Default constructor
       */
       Backpath();
       
@@ -200,7 +301,7 @@ namespace DGtal
 	 @param s to a shortcut s
 	 @param q q
       */
-      Backpath(const FrechetShortcut<ConstIterator,Integer> *s ,int q);
+      Backpath(const FrechetShortcut<ConstIterator,Integer,ConePolicy> *s ,int q);
 
       /**
 	 Copy constructor
@@ -223,7 +324,8 @@ namespace DGtal
       ~Backpath();
       
       /**
-	 Resets the backpath (myFlag, myOcculters)
+	 Resets the backpath (myFlag, myOcculters), whose occulters will
+	 be ordered from the back of the shortcut myS
        */
       void reset();
       
@@ -254,8 +356,53 @@ namespace DGtal
 	 Updates the list of intervals
        */
       void updateIntervals();
-      
-   
+
+      /**
+	 Starts recording the modifications of the backpath in the undo
+	 journal (speculative update)
+      */
+      void beginJournal();
+
+      /**
+	 Keeps the modifications recorded since beginJournal() and
+	 stops recording
+      */
+      void commit();
+
+      /**
+	 Reverts the modifications recorded since beginJournal() and
+	 stops recording. O(number of modifications).
+      */
+      void rollback();
+
+    private:
+
+      /**
+	 Journaled version of myOcculters.erase(iter)
+	 @param iter an iterator on an occulter
+	 @return the iterator following iter
+      */
+      typename occulter_list::iterator eraseOcculter(typename occulter_list::iterator iter);
+
+      /**
+	 Records the attributes of the occulter before their modification
+	 @param iter an iterator on an occulter
+      */
+      void recordOcculter(typename occulter_list::iterator iter);
+
+      /**
+	 Journaled insertion of a new occulter
+	 @param it the occulter point
+	 @param att its attributes
+      */
+      void insertOcculter(const ConstIterator & it, const occulter_attributes & att);
+
+      /**
+	 Journaled insertion of a forbidden interval
+	 @param s an interval
+      */
+      void insertInterval(const Interval & s);
+
     }; // End of class Backpath
 
 
@@ -348,6 +495,98 @@ namespace DGtal
     
       
     };
+
+
+  /**
+     Class ExactCone: the cone of Cone, computed with integers only
+     (FrechetExactCone policy).
+
+     The cone is the set of the directions d such that, for each point q
+     of the shortcut (relative to the first point) at least
+     error/sqrt(2) away from the first point, dot(d,q) >= 0 and 2
+     cross(d,q)^2 <= error^2 |d|^2, i.e. the line of direction d is
+     at most error/sqrt(2) from q, on the side of q. Since the cross
+     and dot products are linear in q, only the vertices of the convex
+     hull of these points are stored.
+
+     The error is rounded to a multiple of 1/1024 (exact for integer
+     errors), the products are computed with 64 bits integers. The
+     squared cross products are not computed, so that the width test
+     is exact while error^2 |d|^2 / 2 < 2^63.
+  */
+  class ExactCone{
+
+  public:
+
+    typedef DGtal::int64_t Integer64;
+    typedef IntegerComputer<Integer64>::Vector2I Direction;
+
+    /**
+       Constructor.
+       @param error the error of the shortcut
+    */
+    ExactCone(double error = 0);
+
+    /**
+       Resets the cone to the whole plane and sets the error.
+       @param error the error of the shortcut
+    */
+    void reset(double error);
+
+    /**
+       @param d a direction, relative to the first point
+       @return 'true' if d belongs to the cone, 'false' otherwise
+       (the null direction belongs to the cone)
+    */
+    bool contains(const Direction & d) const;
+
+    /**
+       Intersects the cone with the cone defined by a new point.
+       @param q a point, relative to the first point
+    */
+    void insert(const Direction & q);
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out) const;
+
+  private:
+
+    /**
+       Bound of cross(d,q)^2 for a direction d of squared norm n,
+       ie floor(error^2 n / 2) computed with the rounded error.
+       @param n a squared norm, such that error^2 n / 2 < 2^63
+       @return the bound
+    */
+    Integer64 bound(Integer64 n) const;
+
+    /**
+       @param b a non-negative integer
+       @return floor(sqrt(b))
+    */
+    static Integer64 squareRoot(Integer64 b);
+
+    /**
+       @param i the index of an edge of the hull (from the vertex i)
+       @param q a point
+       @return 'true' if q is strictly on the right of the edge
+    */
+    bool isVisible(unsigned int i, const Direction & q) const;
+
+    /**
+       Quotient and remainder of the division of (1024 error)^2 by
+       2 1024^2
+    */
+    Integer64 myQuotient, myRemainder;
+
+    /**
+       Vertices of the convex hull of the points that define the cone,
+       counterclockwise
+    */
+    std::vector<Direction> myHull;
+  };
     
     
 
@@ -852,10 +1091,16 @@ public:
   */
     std::vector <Backpath> myBackpath;
   
+  /**
+     Type of the cone, according to the cone policy
+  */
+    typedef typename boost::mpl::if_< boost::is_same<ConePolicy,FrechetExactCone>,
+				      ExactCone, Cone >::type WidthCone;
+
   /** 
       Cone used to update the width 
   */
-    Cone myCone;
+    WidthCone myCone;
   
   /**
    * ConstIterator pointing to the back of the shortcut
@@ -888,7 +1133,9 @@ public:
   /** 
       Test if there exist a backpath of length greater than the threshold
       after the addition of the point pointed by *myEnd+1, but does not
-      modify myBackpath.
+      modify myBackpath. Only the backpath of the octant of the
+      direction [*myBegin,*(myEnd+1)] is updated, within a journaled
+      transaction that is rolled back afterwards.
   */
   bool testUpdateBackpath();
   
@@ -916,7 +1163,8 @@ public:
   
   /**
      Computes the cone defined by the point *myBegin and the new point
-     *myEnd + 1 and intersect it with myCone (unchanged)
+     *myEnd + 1 and intersect it with myCone (unchanged), with the
+     FrechetAngularCone policy
      @return the new cone
    */
   Cone computeNewCone();
@@ -940,6 +1188,22 @@ public:
   
   // ------------------------- Internals ------------------------------------
  private:
+
+  /**
+     testUpdateWidth(), updateWidth() and resetCone() for each cone
+     policy
+  */
+  bool testUpdateWidth(FrechetAngularCone);
+  bool testUpdateWidth(FrechetExactCone);
+  bool updateWidth(FrechetAngularCone);
+  bool updateWidth(FrechetExactCone);
+  void resetCone(FrechetAngularCone);
+  void resetCone(FrechetExactCone);
+
+  /**
+     @return the direction [*myBegin,*(myEnd+1)]
+  */
+  typename ExactCone::Direction newDirection() const;
   
   }; // end of class FrechetShortcut
   
@@ -953,9 +1217,9 @@ public:
    * @param object the object of class 'FrechetShortcut' to write.
    * @return the output stream after the writing.
    */
-  template <typename TIterator,typename TInteger>
+  template <typename TIterator,typename TInteger,typename TConePolicy>
   std::ostream&
-    operator<< ( std::ostream & out, const FrechetShortcut<TIterator,TInteger> & object );
+    operator<< ( std::ostream & out, const FrechetShortcut<TIterator,TInteger,TConePolicy> & object );
 
 
   
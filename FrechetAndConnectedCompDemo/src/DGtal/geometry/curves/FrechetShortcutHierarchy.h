@@ -0,0 +1,271 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FrechetShortcutHierarchy.h
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module FrechetShortcutHierarchy.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(FrechetShortcutHierarchy_RECURSES)
+#error Recursive header files inclusion detected in FrechetShortcutHierarchy.h
+#else // defined(FrechetShortcutHierarchy_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FrechetShortcutHierarchy_RECURSES
+
+#if !defined FrechetShortcutHierarchy_h
+/** Prevents repeated inclusion of headers. */
+#define FrechetShortcutHierarchy_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/IteratorFunctions.h"
+#include "DGtal/geometry/curves/FrechetShortcut.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FrechetShortcutHierarchy
+  /**
+   * Description of template class 'FrechetShortcutHierarchy' <p>
+   * \brief Aim: Simplifies a curve with the FrechetShortcut for
+   * several errors at once, as a nested hierarchy of polylines.
+   *
+   * The levels are sorted by decreasing error. The first (coarsest)
+   * level is the greedy segmentation of the whole curve. Each finer
+   * level is computed by segmenting, with its own error, each part of
+   * the curve between two consecutive vertices of the previous level.
+   * Hence the vertices of a level are also vertices of all the finer
+   * levels, and each edge of a level is a FrechetShortcut (for the
+   * error of this level) of the part of the curve it joins.
+   *
+   * A closed curve is given by a circulator c as the range [c,c):
+   * its polylines are closed, their last part going back to the
+   * first vertex, and the first level is the greedy segmentation of
+   * the whole loop, as in GreedySegmentation.
+   *
+   * The parts of a level are segmented concurrently when DGtal is
+   * built WITH_OPENMP (the first level is split in chunks, see
+   * GreedySegmentation::getSegments()).
+   *
+   * The result is progressive: the vertices of the finest level,
+   * each tagged with its level (see level() and tolerance()), which
+   * is the coarsest level that contains it. The polyline of a level
+   * is made of the vertices whose level is lower than or equal to it.
+   *
+   * @code
+   * std::vector<double> errors;
+   * errors.push_back( 1 ); errors.push_back( 4 ); errors.push_back( 2 );
+   * FrechetShortcutHierarchy<ConstIterator,int> h( errors );
+   * h.init( contour.begin(), contour.end() );
+   * std::vector<ConstIterator> polyline;
+   * h.getVertices( h.levelOf( 2 ), polyline );
+   * @endcode
+   *
+   * @tparam TIterator the type of iterator on the 2D points of the
+   * curve (see FrechetShortcut).
+   * @tparam TInteger the type of integer (see FrechetShortcut).
+   *
+   * @see testFrechetShortcutHierarchy.cpp
+   */
+  template <typename TIterator,
+            typename TInteger = typename IteratorCirculatorTraits<TIterator>::Value::Coordinate>
+  class FrechetShortcutHierarchy
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef TIterator ConstIterator;
+    typedef TInteger Integer;
+    typedef FrechetShortcut<ConstIterator,Integer> SegmentComputer;
+    typedef GreedySegmentation<SegmentComputer> Segmentation;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param errors the errors of the levels, in any order (the
+     * duplicates are ignored).
+     * @param flagWidthOnly if 'true', the simplifications use the
+     * width only (see FrechetShortcut).
+     */
+    FrechetShortcutHierarchy( const std::vector<double> & errors,
+                              bool flagWidthOnly = false );
+
+    /**
+     * Destructor.
+     */
+    ~FrechetShortcutHierarchy();
+
+    /**
+     * Computes all the levels of the curve [itb,ite) (the closed
+     * curve of a circulator if itb == ite).
+     *
+     * @param itb begin iterator of the curve.
+     * @param ite end iterator of the curve.
+     * @param nbChunks the number of chunks of the first level (see
+     * GreedySegmentation::getSegments()).
+     */
+    void init( const ConstIterator & itb, const ConstIterator & ite,
+               unsigned int nbChunks = 1 );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the number of levels.
+     */
+    unsigned int nbLevels() const;
+
+    /**
+     * @param aLevel a level, 0 being the coarsest one.
+     * @return the error of this level.
+     */
+    double error( unsigned int aLevel ) const;
+
+    /**
+     * @param anError any error.
+     * @return the coarsest level whose error is lower than or equal to
+     * anError (the finest level if there is none).
+     */
+    unsigned int levelOf( double anError ) const;
+
+    /**
+     * @return the vertices of the finest level, which contain the
+     * vertices of all the levels, in the order of the curve.
+     */
+    const std::vector<ConstIterator> & vertices() const;
+
+    /**
+     * @param i the index of a vertex of the finest level.
+     * @return the coarsest level that contains this vertex.
+     */
+    unsigned int level( unsigned int i ) const;
+
+    /**
+     * @param i the index of a vertex of the finest level.
+     * @return the largest error of the levels that contain this
+     * vertex.
+     */
+    double tolerance( unsigned int i ) const;
+
+    /**
+     * Gets the vertices of a level.
+     *
+     * @param aLevel a level, 0 being the coarsest one.
+     * @param aVertices (returns) the vertices of the level.
+     */
+    void getVertices( unsigned int aLevel,
+                      std::vector<ConstIterator> & aVertices ) const;
+
+    /**
+     * @param aLevel a level, 0 being the coarsest one.
+     * @return the time spent to compute this level, in milliseconds.
+     */
+    double time( unsigned int aLevel ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The errors of the levels, by decreasing value.
+    std::vector<double> myErrors;
+    /// If 'true', the simplifications use the width only.
+    bool myFlagWidthOnly;
+    /// The vertices of the finest level.
+    std::vector<ConstIterator> myVertices;
+    /// The coarsest level of each vertex.
+    std::vector<unsigned int> myLevels;
+    /// The time spent to compute each level.
+    std::vector<double> myTimes;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Appends to aVertices the vertices of the segments of
+     * aSegments, without the last point of the range they cover.
+     *
+     * @param aSegments the segments of a greedy segmentation.
+     * @param aLast the last point of the range.
+     * @param aVertices the vertices.
+     */
+    static void appendVertices( const std::vector<SegmentComputer> & aSegments,
+                                const ConstIterator & aLast,
+                                std::vector<ConstIterator> & aVertices );
+
+    /**
+     * Appends to aVertices the vertices of the segments of
+     * aSegments, which cover a whole closed curve.
+     *
+     * @param aSegments the segments of a greedy segmentation.
+     * @param aVertices the vertices.
+     */
+    static void appendLoopVertices( const std::vector<SegmentComputer> & aSegments,
+                                    std::vector<ConstIterator> & aVertices );
+
+  }; // end of class FrechetShortcutHierarchy
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FrechetShortcutHierarchy'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FrechetShortcutHierarchy' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TIterator, typename TInteger>
+  std::ostream&
+  operator<< ( std::ostream & out, const FrechetShortcutHierarchy<TIterator,TInteger> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/FrechetShortcutHierarchy.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FrechetShortcutHierarchy_h
+
+#undef FrechetShortcutHierarchy_RECURSES
+#endif // else defined(FrechetShortcutHierarchy_RECURSES)
@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/geometry/curves/CForwardSegmentComputer.h"
 
@@ -141,6 +142,15 @@ namespace DGtal
    * @endcode  
    * Note that the default mode will be used for any unknown modes.  
    *
+   * All the segments may also be computed at once with getSegments(),
+   * which splits the range into chunks segmented concurrently (when
+   * DGtal is built WITH_OPENMP) and gives exactly the segments of the
+   * sequential greedy segmentation:
+   * @code 
+  std::vector<SegmentComputer> segments;
+  theSegmentation.getSegments(segments, 16);
+   * @endcode  
+   *
    * @see testSegmentation.cpp 
    */
 
@@ -412,6 +422,30 @@ namespace DGtal
     void setMode(const std::string& aMode);
 
 
+    /**
+     * Computes all the segments of the segmentation, i.e. the ones
+     * visited by a SegmentComputerIterator from begin() to end().
+     *
+     * The range is split into @a aNbChunks chunks, which are segmented
+     * independently (concurrently WITH_OPENMP) from their first
+     * element. Since the next segment only depends on the first
+     * element of the current one, the segmentation of a chunk
+     * coincides with the sequential one as soon as they share the
+     * first element of a segment: the segments of a chunk are kept
+     * from there, the ones before it are computed again from the
+     * end of the previous chunk.
+     *
+     * Nb: the range is processed sequentially (a single chunk) for
+     * circulators. The chunks are built with std::distance and
+     * std::advance, hence random access iterators are better.
+     *
+     * @param aSegments (returns) the segments.
+     * @param aNbChunks the number of chunks (1 for the sequential
+     * segmentation).
+     */
+    void getSegments( std::vector<SegmentComputer> & aSegments,
+                      unsigned int aNbChunks = 1 ) const;
+
     /**
      * Destructor.
      */
@@ -498,6 +532,47 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * The segments computed independently from the first element of a
+     * chunk.
+     */
+    struct Chunk
+    {
+      /// The first element of each segment.
+      std::vector<ConstIterator> starts;
+      /// The segments.
+      std::vector<SegmentComputer> segments;
+      /// The first element of the next segment, after the chunk.
+      ConstIterator exit;
+      /// 'true' if the last segment is the last one of the segmentation.
+      bool isLast;
+    };
+
+    /**
+     * Computes the segment starting at @a aStart.
+     *
+     * @param it (modified) an iterator of this segmentation, whose
+     * current segment becomes the computed one.
+     * @param aStart the first element of the segment.
+     * @param aNext (returns) the first element of the next segment.
+     * @return 'false' if the segment is the last one, 'true' otherwise.
+     */
+    bool nextSegment( SegmentComputerIterator & it,
+                      const ConstIterator & aStart,
+                      ConstIterator & aNext ) const;
+
+    /**
+     * Computes the segments from @a aStart until the first element of
+     * the next segment is at least at @a aLimit elements from myStart.
+     *
+     * @param aStart the first element of the chunk.
+     * @param aLimit the end of the chunk, as a distance to myStart.
+     * @param aChunk (returns) the segments of the chunk.
+     */
+    template <typename TDifference>
+    void segmentChunk( const ConstIterator & aStart, TDifference aLimit,
+                       Chunk & aChunk ) const;
+
   }; // end of class GreedySegmentation
 
 
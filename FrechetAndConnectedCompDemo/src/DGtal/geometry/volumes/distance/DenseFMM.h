@@ -0,0 +1,539 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DenseFMM.h
+ *
+ * @date 2026/10/17
+ *
+ * @brief Fast Marching Method with an indexed heap and a state array
+ * over the image domain
+ *
+ * This file is part of the DGtal library.
+ *
+ */
+
+#if defined(DenseFMM_RECURSES)
+#error Recursive header files inclusion detected in DenseFMM.h
+#else // defined(DenseFMM_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DenseFMM_RECURSES
+
+#if !defined DenseFMM_h
+/** Prevents repeated inclusion of headers. */
+#define DenseFMM_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <limits>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/CPointFunctor.h"
+#include "DGtal/geometry/volumes/distance/FMMPointFunctors.h"
+#include "DGtal/geometry/volumes/distance/FMM.h"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DenseFMM
+  /**
+   * Description of template class 'DenseFMM' <p>
+   * \brief Aim: Fast Marching Method (FMM) for nd distance transforms,
+   * whose candidate points are kept in an indexed binary heap and
+   * whose point states are kept in an array over the image domain.
+   *
+   * The algorithm, the parameters and the results are those of FMM:
+   * the same points are accepted in the same order, with the same
+   * distance values. Only the bookkeeping differs. FMM stores the
+   * candidates in a STL set of pairs (point, tentative value), a new
+   * pair being inserted each time a tentative value is computed, and
+   * looks for the accepted points in the set of accepted points.
+   * DenseFMM stores for each point of the image domain whether it is
+   * accepted, or the position of its candidate in the heap. A
+   * candidate appears once in the heap: when a smaller tentative
+   * value is computed, its key is decreased in place. Every step is
+   * thus a few array accesses and a logarithmic number of swaps in a
+   * contiguous heap, without memory allocation.
+   *
+   * The state array costs an int per point of the image domain, which
+   * must contain the points accepted by the point predicate. DenseFMM
+   * is therefore meant for images whose domain is about the size of
+   * the computation domain, typically ImageContainerBySTLVector. FMM
+   * remains preferable for a narrow band computed in a huge domain,
+   * with an ImageContainerBySTLMap.
+   *
+   * When a value threshold is given, the propagation is bounded: the
+   * candidates whose tentative value is not below the threshold are
+   * not inserted into the heap (they would never be accepted) and the
+   * computation stops as soon as the heap is empty.
+   *
+   * The point functor still finds the accepted neighbors of a point
+   * in the set of accepted points: DigitalSetByBitGrid is the natural
+   * set to use with this class.
+   *
+   * The image and the set are initialized by the same static
+   * functions as in FMM.
+   *
+   * @tparam TImage  any model of CImage
+   * @tparam TSet  any model of CDigitalSet
+   * @tparam TPointPredicate  any model of CPointPredicate,
+   * used to bound the computation within a domain
+   * @tparam TPointFunctor  any model of CPointFunctor,
+   * used to compute the new distance value
+   *
+   * @code
+   * typedef ImageContainerBySTLVector<Z3i::Domain, double> Image;
+   * typedef DigitalSetByBitGrid<Z3i::Domain> Set;
+   * typedef DomainPredicate<Z3i::Domain> Predicate;
+   * typedef DenseFMM<Image, Set, Predicate> FMM;
+   * Image image( domain );
+   * Set set( domain );
+   * insertAndSetValue( image, set, Z3i::Point(0,0,0), 0.0 );
+   * Predicate predicate( domain );
+   * FMM fmm( image, set, predicate, domain.size()+1, 10.0 );
+   * fmm.compute();
+   * @endcode
+   *
+   * @see FMM.h
+   * @see testDenseFMM.cpp
+   */
+  template <typename TImage, typename TSet, typename TPointPredicate,
+	    typename TPointFunctor = L2FirstOrderLocalDistance<TImage,TSet> >
+  class DenseFMM
+  {
+
+    // ----------------------- Types ------------------------------
+  public:
+
+
+    //concept assert
+    BOOST_CONCEPT_ASSERT(( CImage<TImage> ));
+    BOOST_CONCEPT_ASSERT(( CDigitalSet<TSet> ));
+    BOOST_CONCEPT_ASSERT(( CPointPredicate<TPointPredicate> ));
+    BOOST_CONCEPT_ASSERT(( CPointFunctor<TPointFunctor> ));
+
+    typedef TImage Image;
+    typedef TSet AcceptedPointSet;
+    typedef TPointPredicate PointPredicate;
+    typedef typename Image::Domain Domain;
+
+    //points
+    typedef typename Image::Point Vector;
+    typedef typename Image::Point Point;
+    BOOST_STATIC_ASSERT(( boost::is_same< Point, typename AcceptedPointSet::Point >::value ));
+    BOOST_STATIC_ASSERT(( boost::is_same< Point, typename PointPredicate::Point >::value ));
+
+    //dimension
+    typedef typename Point::Dimension Dimension;
+    static const Dimension dimension = Point::dimension;
+
+    //distance
+    typedef TPointFunctor PointFunctor;
+    typedef typename PointFunctor::Value Value;
+
+
+  private:
+
+    //intern data types
+    typedef unsigned long Area;
+    typedef typename Domain::Size Index;
+
+    /**
+     * A candidate point of the heap, with its tentative value and
+     * the index of the point in the domain.
+     */
+    struct Candidate
+    {
+      Point point;
+      Value value;
+      Index index;
+    };
+    typedef std::vector<Candidate> Heap;
+
+    /// states of the points that are not candidates: neither
+    /// accepted nor candidate, accepted
+    enum { farPoint = -1, acceptedPoint = -2 };
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /**
+     * Reference on the image
+     */
+    Image& myImage;
+
+    /**
+     * Reference on the set of accepted points
+     */
+    AcceptedPointSet& myAcceptedPoints;
+
+    /**
+     * Pointer on the point functor used to deduce
+     * the distance of a new point
+     * from the distance of its neighbors
+     */
+    PointFunctor* myPointFunctorPtr;
+
+    /**
+     * 'true' if @a myPointFunctorPtr is an owning pointer
+     * (default case), 'false' if it is an aliasing pointer
+     * on a point functor given at construction
+     */
+    const bool myFlagIsOwning;
+
+    /**
+     * Constant reference on a point predicate that returns
+     * 'true' inside the domain
+     * where the distance transform is performed
+     */
+    const PointPredicate& myPointPredicate;
+
+    /**
+     * Area threshold (in number of accepted points)
+     * above which the propagation stops
+     */
+    Area myAreaThreshold;
+
+    /**
+     * Value threshold above which the propagation stops
+     */
+    Value myValueThreshold;
+
+    /**
+     * Min value
+     */
+    Value myMinValue;
+
+    /**
+     * Max value
+     */
+    Value myMaxValue;
+
+    /**
+     * Copy of the image domain
+     */
+    Domain myDomain;
+
+    /**
+     * Distance between the indices of two neighbors along each axis
+     */
+    Index mySteps[ dimension ];
+
+    /**
+     * For each point of the domain, farPoint, acceptedPoint or the position
+     * of its candidate in the heap
+     */
+    std::vector<int> myStates;
+
+    /**
+     * Binary heap of the candidate points, the candidate of min
+     * (absolute) tentative value first
+     */
+    Heap myHeap;
+
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @see init
+     */
+    DenseFMM(Image& aImg, AcceptedPointSet& aSet,
+	     const PointPredicate& aPointPredicate);
+
+    /**
+     * Constructor.
+     *
+     * @see init
+     */
+    DenseFMM(Image& aImg, AcceptedPointSet& aSet,
+	     const PointPredicate& aPointPredicate,
+	     const Area& aAreaThreshold, const Value& aValueThreshold);
+
+    /**
+     * Constructor.
+     *
+     * @see init
+     */
+    DenseFMM(Image& aImg, AcceptedPointSet& aSet,
+	     const PointPredicate& aPointPredicate,
+	     PointFunctor& aPointFunctor );
+
+    /**
+     * Constructor.
+     *
+     * @see init
+     */
+    DenseFMM(Image& aImg, AcceptedPointSet& aSet,
+	     const PointPredicate& aPointPredicate,
+	     const Area& aAreaThreshold, const Value& aValueThreshold,
+	     PointFunctor& aPointFunctor );
+
+    /**
+     * Destructor.
+     */
+    ~DenseFMM();
+
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Computation of the signed distance function by marching out
+     * from the initial set of accepted points.
+     * While it is possible, the candidate of min distance is
+     * inserted into the set of accepted points.
+     *
+     * @see computeOneStep
+     */
+    void compute();
+
+    /**
+     * Inserts the candidate of min distance into the set
+     * of accepted points if it is possible and then
+     * updates the distance values associated to the candidate points.
+     *
+     * @param aPoint inserted point (if inserted)
+     * @param aValue its distance value (if inserted)
+     *
+     * @return 'true' if the point of min distance is accepted
+     * 'false' otherwise.
+     *
+     * @see addNewAcceptedPoint
+     */
+    bool computeOneStep(Point& aPoint, Value& aValue);
+
+    /**
+     * Minimal distance value in the set of accepted points.
+     *
+     * @return minimal distance value.
+     */
+    Value min() const;
+
+    /**
+     * Maximal distance value in the set of accepted points.
+     *
+     * @return maximal distance value
+     */
+    Value max() const;
+
+    /**
+     * Computes the minimal distance value in the set of accepted points.
+     *
+     * @return minimal distance value.
+     */
+    Value getMin() const;
+
+    /**
+     * Computes the maximal distance value in the set of accepted points.
+     *
+     * @return maximal distance value.
+     */
+    Value getMax() const;
+
+    /**
+     * @return the number of candidate points.
+     */
+    unsigned long nbCandidates() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- static functions for init --------------------
+
+    /**
+     * Initialize @a aImg and @a aSet from the points of a range.
+     * @see FMM::initFromPointsRange
+     */
+    template <typename TIteratorOnPoints>
+    static void initFromPointsRange(const TIteratorOnPoints& itb, const TIteratorOnPoints& ite,
+				    Image& aImg, AcceptedPointSet& aSet,
+				    const Value& aValue);
+
+    /**
+     * Initialize @a aImg and @a aSet from the points incident to
+     * the signed cells of a range.
+     * @see FMM::initFromBelsRange
+     */
+    template <typename KSpace, typename TIteratorOnBels>
+    static void initFromBelsRange(const KSpace& aK,
+				  const TIteratorOnBels& itb, const TIteratorOnBels& ite,
+				  Image& aImg, AcceptedPointSet& aSet,
+				  const Value& aValue,
+				  bool aFlagIsPositive = false);
+
+    /**
+     * Initialize @a aImg and @a aSet from the points incident to
+     * the signed cells of a range and an implicit function.
+     * @see FMM::initFromBelsRange
+     */
+    template <typename KSpace, typename TIteratorOnBels, typename TImplicitFunction>
+    static void initFromBelsRange(const KSpace& aK,
+				  const TIteratorOnBels& itb, const TIteratorOnBels& ite,
+				  const TImplicitFunction& aF,
+				  Image& aImg, AcceptedPointSet& aSet,
+				  bool aFlagIsPositive = false);
+
+    /**
+     * Initialize @a aImg and @a aSet from the inner and outer points
+     * of a range of pairs of points.
+     * @see FMM::initFromIncidentPointsRange
+     */
+    template <typename TIteratorOnPairs>
+    static void initFromIncidentPointsRange(const TIteratorOnPairs& itb, const TIteratorOnPairs& ite,
+					    Image& aImg, AcceptedPointSet& aSet,
+					    const Value& aValue,
+					    bool aFlagIsPositive = false);
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    DenseFMM ( const DenseFMM & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    DenseFMM & operator= ( const DenseFMM & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Initialize the state array from the set of accepted points
+     * and the heap of candidate points
+     */
+    void init();
+
+    /**
+     * Inserts the candidate of min distance into the set
+     * of accepted points and updates the distance values
+     * of the candidate points.
+     *
+     * @param aPoint inserted point (if true)
+     * @param aValue distance value of the inserted point (if true)
+     *
+     * @return 'true' if the point of min distance is accepted
+     * 'false' otherwise.
+     */
+    bool addNewAcceptedPoint(Point& aPoint, Value& aValue);
+
+    /**
+     * Updates the distance values of the neighbors of @a aPoint
+     * (of index @a aIndex) lying in the domain.
+     *
+     * @param aPoint any point of the domain
+     * @param aIndex its index
+     */
+    void update(const Point& aPoint, const Index& aIndex);
+
+    /**
+     * Tests a new point as a candidate.
+     * If it is not yet accepted
+     * and if the point predicate returns 'true',
+     * computes its distance and inserts it
+     * into the heap, or decreases its key
+     * if it is already a candidate.
+     *
+     * @param aPoint any point of the domain
+     * @param aIndex its index
+     *
+     * @return 'true' if inserted or decreased,
+     * 'false' otherwise.
+     */
+    bool addNewCandidate(const Point& aPoint, const Index& aIndex);
+
+    /**
+     * @param aPoint any point
+     * @param aIndex (returns) its index if it lies in the domain
+     * @return 'true' if @a aPoint lies in the domain.
+     */
+    bool index(const Point& aPoint, Index& aIndex) const;
+
+    /**
+     * Order of the candidates, the same as the order of the pairs
+     * of FMM.
+     *
+     * @return 'true' if @a a must be accepted before @a b.
+     */
+    static bool before(const Candidate& a, const Candidate& b);
+
+    /**
+     * Moves the candidate at position @a aPos towards the top of
+     * the heap.
+     */
+    void siftUp(int aPos);
+
+    /**
+     * Moves the candidate at position @a aPos towards the bottom of
+     * the heap.
+     */
+    void siftDown(int aPos);
+
+  }; // end of class DenseFMM
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DenseFMM'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DenseFMM' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImage, typename TSet, typename TPointPredicate, typename TPointFunctor >
+  std::ostream&
+  operator<< ( std::ostream & out, const DenseFMM<TImage, TSet, TPointPredicate, TPointFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/DenseFMM.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DenseFMM_h
+
+#undef DenseFMM_RECURSES
+#endif // else defined(DenseFMM_RECURSES)
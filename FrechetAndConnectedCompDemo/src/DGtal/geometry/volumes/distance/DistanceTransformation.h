@@ -125,9 +125,9 @@ namespace DGtal
                          typename SeparableMetric::Point>::value));
     
     ///Definition of the image.
-    typedef  DistanceTransformation<TSpace,TPointPredicate,TSeparableMetric> Self;
+    typedef  DistanceTransformation<TSpace,TPointPredicate,TSeparableMetric,TImageContainer> Self;
     
-    typedef VoronoiMap<TSpace,TPointPredicate,TSeparableMetric> Parent;
+    typedef VoronoiMap<TSpace,TPointPredicate,TSeparableMetric,TImageContainer> Parent;
    
     ///Definition of the image constRange
     typedef  DefaultConstImageRange<Self> ConstRange;
@@ -143,10 +143,12 @@ namespace DGtal
      */
     DistanceTransformation(ConstAlias<Domain> aDomain,
                            ConstAlias<PointPredicate> predicate,
-                           ConstAlias<SeparableMetric> aMetric):
+                           ConstAlias<SeparableMetric> aMetric,
+                           bool incremental = false):
       VoronoiMap<TSpace,TPointPredicate,TSeparableMetric,TImageContainer>(aDomain,
                                                                           predicate,
-                                                                          aMetric)
+                                                                          aMetric,
+                                                                          incremental)
     {}
     
     /**
@@ -124,6 +124,10 @@ namespace DGtal
    * of the newly added point. The search of the point of smallest
    * tentative value is accelerated using a STL set of pairs (point, 
    * tentative value).  
+   * DenseFMM computes the same values with an indexed heap and an
+   * array of point states over the image domain, which is much
+   * faster when the image domain is not much bigger than the
+   * computation domain. 
    *
    * @tparam TImage  any model of CImage
    * @tparam TSet  any model of CDigitalSet
@@ -141,6 +145,7 @@ namespace DGtal
    * @see exampleFMM2D.cpp
    * @see exampleFMM3D.cpp
    * @see testFMM.cpp
+   * @see DenseFMM.h
    */
   template <typename TImage, typename TSet, typename TPointPredicate, 
 	    typename TPointFunctor = L2FirstOrderLocalDistance<TImage,TSet> >
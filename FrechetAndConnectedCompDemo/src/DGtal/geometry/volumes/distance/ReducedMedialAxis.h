@@ -45,6 +45,8 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <utility>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/kernel/CPointPredicate.h"
@@ -100,6 +102,18 @@ namespace DGtal
     //MA Container
     typedef Image<TImageContainer> Type;
 
+    ///Power map type (the parent class of a ReverseDistanceTransformation)
+    typedef PowerMap<typename TPowerMap::WeightImage,
+                     typename TPowerMap::PowerSeparableMetric,
+                     typename TPowerMap::OutputImage> PowerMapType;
+    typedef typename PowerMapType::Domain Domain;
+    typedef typename PowerMapType::Point Point;
+    typedef typename PowerMapType::Weight Weight;
+
+    ///A medial ball: its center and its weight
+    typedef std::pair<Point, Weight> Ball;
+    typedef std::vector<Ball> Balls;
+
     /** 
      * Extract reduced medial axis from a power map.
      * This methods is in @f$ O(|powerMap|)@f$. 
@@ -112,22 +126,96 @@ namespace DGtal
     static 
     Type getReducedMedialAxisFromPowerMap(const TPowerMap &aPowerMap) 
     {
-      typename TPowerMap::Value v;
+      Balls balls;
+      getReducedMedialAxisBalls( aPowerMap, balls );
       TImageContainer *computedMA = new TImageContainer( aPowerMap.domain() );
-      for (typename TPowerMap::Domain::ConstIterator it = aPowerMap.domain().begin(), 
-             itend = aPowerMap.domain().end(); it != itend; ++it)
+      for (typename Balls::const_iterator it = balls.begin(), itend = balls.end();
+           it != itend; ++it)
+        computedMA->setValue( it->first, it->second );
+      return Type( computedMA );
+    }
+
+    /** 
+     * Extract reduced medial axis from a power map, as a list of
+     * weighted balls sorted by center. 
+     *
+     * The power map may be a ReverseDistanceTransformation: the
+     * same separable computation then gives both the reconstructed
+     * shape (the points of negative value) and its medial axis.
+     *
+     * The domain is cut into slabs along the last dimension, scanned
+     * in parallel when OpenMP is enabled. This methods is in @f$
+     * O(|powerMap| + m.log(m))@f$ for m medial balls.
+     *
+     * @param aPowerMap the input powerMap
+     * @param balls (returns) the medial balls.
+     */
+    static 
+    void getReducedMedialAxisBalls(const TPowerMap &aPowerMap, Balls &balls) 
+    {
+      const PowerMapType &power = aPowerMap;
+      const Domain &domain = power.domain();
+      const typename Point::Dimension last = Point::dimension - 1;
+      const int nbSlabs = domain.upperBound()[ last ] - domain.lowerBound()[ last ] + 1;
+      std::vector< std::vector<Point> > centers( nbSlabs );
+
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+      for (int i = 0; i < nbSlabs; ++i)
         {
-          v =  aPowerMap(*it);
-          if  (aPowerMap.metricPtr()->powerDistance(*it, 
-                                                    v,
-                                                    aPowerMap.weightImagePtr()->operator()( v )) 
-               < NumberTraits<typename TPowerMap::PowerSeparableMetric::Value>::ZERO )
-            
-            computedMA->setValue( v,
-                                  aPowerMap.weightImagePtr()->operator()( v ));
+          Point lower = domain.lowerBound();
+          Point upper = domain.upperBound();
+          lower[ last ] += i;
+          upper[ last ] = lower[ last ];
+          getSlabCenters( power, Domain( lower, upper ), centers[ i ] );
+        }
+
+      std::vector<Point> all;
+      for (int i = 0; i < nbSlabs; ++i)
+        all.insert( all.end(), centers[ i ].begin(), centers[ i ].end() );
+      std::sort( all.begin(), all.end() );
+      all.erase( std::unique( all.begin(), all.end() ), all.end() );
+
+      balls.clear();
+      balls.reserve( all.size() );
+      for (typename std::vector<Point>::const_iterator it = all.begin(), itend = all.end();
+           it != itend; ++it)
+        balls.push_back( Ball( *it, power.weightImagePtr()->operator()( *it ) ) );
+    }
 
+  private:
+
+    /** 
+     * Collects the sites of a power map whose power cell contains a
+     * point of negative power distance in a slab (a site may be
+     * collected several times).
+     *
+     * @param aPowerMap the input powerMap
+     * @param aSlab a subdomain of the power map domain
+     * @param centers (returns) the sites
+     */
+    static 
+    void getSlabCenters(const PowerMapType &aPowerMap, const Domain &aSlab,
+                        std::vector<Point> &centers)
+    {
+      const typename PowerMapType::WeightImage &weights = *aPowerMap.weightImagePtr();
+      bool found = false;
+      Point last;
+      for (typename Domain::ConstIterator it = aSlab.begin(), itend = aSlab.end(); 
+           it != itend; ++it)
+        {
+          Point v = aPowerMap(*it);
+          if ( ( found && ( v == last ) ) || ( ! weights.domain().isInside( v ) ) )
+            continue;
+          if  (aPowerMap.metricPtr()->powerDistance(*it, v, weights( v )) 
+               < NumberTraits<typename TPowerMap::PowerSeparableMetric::Value>::ZERO )
+            {
+              centers.push_back( v );
+              found = true;
+              last = v;
+            }
         }
-      return Type( computedMA );
     }
   }; // end of class ReducedMedialAxis
 
@@ -124,7 +124,7 @@ namespace DGtal
                                            TPSeparableMetric,
                                            TImageContainer> Self;
     
-    typedef PowerMap<TWeightImage,TPSeparableMetric> Parent;
+    typedef PowerMap<TWeightImage,TPSeparableMetric,TImageContainer> Parent;
    
     ///Definition of the image constRange
     typedef  DefaultConstImageRange<Self> ConstRange;
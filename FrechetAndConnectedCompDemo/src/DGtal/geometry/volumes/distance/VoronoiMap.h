@@ -45,7 +45,11 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <set>
+#include <algorithm>
+#include <cstddef>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
 #include "DGtal/base/CountedPtr.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/kernel/CPointPredicate.h"
@@ -91,6 +95,11 @@ namespace DGtal
    * in an optimal way: on @a p processors, expected runtime is in
    * @f$ O(h.d.n^d / p)@f$.
    *
+   * A map built with the @a incremental flag keeps the result of each
+   * 1D pass (except the last one, which is the map itself), so that
+   * it can be updated after local changes of the point predicate:
+   * see update().
+   *
    * This class is a model of CConstImage.
    *
    * @tparam TSpace type of Digital Space (model of CSpace).
@@ -166,6 +175,9 @@ namespace DGtal
     ///Self type
     typedef VoronoiMap<TSpace, TPointPredicate, 
 		       TSeparableMetric,TImageContainer> Self;
+
+    ///Number of adjacent rows updated together.
+    static const Size tileWidth = 16;
     
 
     /**
@@ -185,10 +197,15 @@ namespace DGtal
      * Voronoi sites (false points).
      * 
      *@param aMetric a pointer to the separable metric instance.
+     *
+     * @param incremental when 'true', the results of the intermediate
+     * passes are kept (d-1 more images) so that the map can be
+     * updated (see update()).
      */
     VoronoiMap(ConstAlias<Domain> aDomain,
                ConstAlias<PointPredicate> predicate,
-               ConstAlias<SeparableMetric> aMetric);
+               ConstAlias<SeparableMetric> aMetric,
+               bool incremental = false);
 
     /**
      * Default destructor
@@ -236,6 +253,32 @@ namespace DGtal
       return myImagePtr->operator()(aPoint);
     }    
      
+    /**
+     * Updates the Voronoi map after changes of the point predicate
+     * (sites added or removed) inside the box [aLower, aUpper]. Pass
+     * after pass, only the rows crossing the box, then the rows
+     * crossing a value changed by the previous pass, are recomputed,
+     * with the same 1D step as the construction: the map is then the
+     * same as a new one built from the current predicate.
+     *
+     * @pre the map has been built with the @a incremental flag.
+     *
+     * @param aLower the lower bound of the box of the changes.
+     * @param aUpper the upper bound of the box of the changes.
+     * @return the number of rows recomputed.
+     * @throw InputException if the map has not been built with the
+     * @a incremental flag.
+     */
+    Size update(const Point &aLower, const Point &aUpper);
+
+    /**
+     * @return 'true' if the map can be updated (see update()).
+     */
+    bool isIncremental() const
+    {
+      return myIncremental;
+    }
+
     /** 
      * @return Returns an alias to the underlying metric.
      */
@@ -263,12 +306,45 @@ namespace DGtal
     void compute ( ) ;
 
 
+    /**
+     * @return a copy of the current Voronoi map image, which does not
+     * share its values with it.
+     */
+    CountedPtr<OutputImage> copyImage() const;
+
     /** 
      *  Compute the other steps of the separable Voronoi map.
+     *
+     *  The 1D problems along dimension @a dim are solved by tiles
+     *  of (at most) tileWidth adjacent rows: the rows of a tile are
+     *  copied into a contiguous buffer (one row after the other),
+     *  updated there, and copied back. For the vector container, the
+     *  copies work on its values directly, reading and writing
+     *  tileWidth consecutive values at a time when @a dim is not 0.
+     *  The tiles are processed in parallel when OpenMP is enabled.
      * 
      * @param [in] dim the dimension to process
      */    
     void computeOtherSteps(const Dimension dim) const;
+
+    /**
+     * Updates the Voronoi map along @a width adjacent rows of
+     * dimension @a dim.
+     *
+     * @param [in] startingPoint the starting point of the first row.
+     * @param [in] width the number of rows.
+     * @param [in] across the dimension along which the rows are adjacent.
+     * @param [in] dim dimension of the update.
+     * @param tile buffer for the values of the rows.
+     * @param sites buffer for the sites of a row.
+     */
+    void computeOtherTile(const Point &startingPoint,
+                          const Size width,
+                          const Dimension across,
+                          const Dimension dim,
+                          std::vector<Value> &tile,
+                          std::vector<Point> &sites) const;
+
     /** 
      * Given  a voronoi map valid at dimension @a dim-1, this method
      * updates the map to make it consistent at dimension @a dim along
@@ -277,9 +353,31 @@ namespace DGtal
      * 
      * @param [in] row starting point of the 1D process.
      * @param [in] dim dimension of the update.
+     * @param [in,out] values the values of the map along the row,
+     * updated in place.
+     * @param sites buffer for the sites of the row.
      */
     void computeOtherStep1D (const Point &row, 
-			     const Size dim) const;
+			     const Size dim,
+                             Value * values,
+                             std::vector<Point> &sites) const;
+
+    /**
+     * @return a pointer to the values of the image in the order of
+     * its domain, or 0 if they are not stored contiguously.
+     */
+    template <typename TOtherImage>
+    static Value * imageValues( TOtherImage & )
+    {
+      return 0;
+    }
+
+    /// Specialization for the vector container.
+    template <typename TDomain>
+    static Value * imageValues( ImageContainerBySTLVector<TDomain,Value> & anImage )
+    {
+      return anImage.empty() ? 0 : &anImage[ 0 ];
+    }
     
     // ------------------- protected methods ------------------------
   protected:
@@ -309,6 +407,12 @@ namespace DGtal
     ///Value to act as a +infinity value
     Point myInfinity;
 
+    ///If true, the intermediate passes are kept
+    bool myIncremental;
+
+    ///Results of the passes along dimensions 0 to n-2 (incremental maps)
+    std::vector< CountedPtr<OutputImage> > mySteps;
+
   protected:
 
     ///Pointer to the separable metric instance
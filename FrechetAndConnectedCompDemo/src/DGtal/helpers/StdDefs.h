@@ -91,6 +91,7 @@ namespace DGtal
     typedef Space::RealVector RealVector;
     typedef HyperRectDomain< Space > Domain; 
     typedef DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+    typedef DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS+BIT_GRID_DS >::Type BitGridDigitalSet;
     typedef Object<DT4_8, DigitalSet> Object4_8;
     typedef Object<DT4_8, DigitalSet>::ComplementObject ComplementObject4_8;
     typedef Object<DT4_8, DigitalSet>::SmallObject SmallObject4_8;
@@ -158,6 +159,7 @@ namespace DGtal
     typedef Space::RealVector RealVector;
     typedef HyperRectDomain< Space > Domain; 
     typedef DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+    typedef DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS+BIT_GRID_DS >::Type BitGridDigitalSet;
     typedef Object<DT6_18, DigitalSet> Object6_18;
     typedef Object<DT6_18, DigitalSet>::ComplementObject ComplementObject6_18;
     typedef Object<DT6_18, DigitalSet>::SmallObject SmallObject6_18;
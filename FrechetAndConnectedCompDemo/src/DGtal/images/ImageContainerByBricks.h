@@ -0,0 +1,399 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByBricks.h
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module ImageContainerByBricks.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByBricks_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByBricks.h
+#else // defined(ImageContainerByBricks_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByBricks_RECURSES
+
+#if !defined ImageContainerByBricks_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByBricks_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CountedPtr.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/SetValueIterator.h"
+#include "DGtal/base/CLabel.h"
+#include "DGtal/kernel/domains/CDomain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContainerByBricks
+  /**
+   * Description of template class 'ImageContainerByBricks' <p>
+   * \brief Aim: Model of CImage storing its values out of core, in a
+   * file cut into bricks (cubes of TBrickSide^n values), so that
+   * images bigger than the main memory can be processed.
+   *
+   * The domain is cut into a grid of bricks, the lower brick being
+   * anchored at the lower bound of the domain (the bricks of the
+   * upper border are partly outside the domain). Each brick is stored
+   * contiguously in the file, its values in the order of the domain
+   * (first coordinate varying fastest), and the bricks follow each
+   * other in the same order. Only a fixed number of bricks (the cache
+   * size) are memory-mapped at any time: accessing a value of
+   * another brick unmaps the least recently used one, the operating
+   * system writing back its modified pages. The memory footprint of
+   * the image is thus bounded by cacheSize() * brickSize values,
+   * whatever the size of its domain.
+   *
+   * The file is either a temporary file, removed with the last copy
+   * of the image, or a named file that can be reopened later with the
+   * same domain. A new file is sparse: its values are zero until they
+   * are written. The values are therefore expected to be plain data
+   * (integers, floating-point numbers, PointVector...).
+   *
+   * As with the other containers, the values are read with
+   * operator() and written with setValue(), the image domain or the
+   * ranges giving the points in the order of the domain. Since
+   * consecutive points of different rows may lie in different bricks,
+   * the algorithms running on big images should rather scan the image
+   * brick by brick, the domain of each brick being given by
+   * brickDomain().
+   *
+   * The copies of an image share its values (like the ITK
+   * container): the image is cheap to copy and to return by value.
+   *
+   * @tparam TDomain a model of CDomain, a HyperRectDomain.
+   * @tparam TValue the type of the values, a plain data type.
+   * @tparam TBrickSide the number of values on a side of a brick, a
+   * power of two (default 32).
+   *
+   * @code
+   * typedef ImageContainerByBricks<Z3i::Domain, DGtal::uint32_t> Image;
+   * Image image( domain, "image.bricks", true, 512 );
+   * for ( Image::Size b = 0; b < image.nbBricks(); ++b )
+   *   {
+   *     Z3i::Domain brick = image.brickDomain( b );
+   *     for ( Z3i::Domain::ConstIterator it = brick.begin(), itend = brick.end();
+   *           it != itend; ++it )
+   *       image.setValue( *it, f( *it ) );
+   *   }
+   * @endcode
+   *
+   * @see testImageContainerByBricks.cpp
+   */
+  template <typename TDomain, typename TValue, unsigned int TBrickSide = 32>
+  class ImageContainerByBricks
+  {
+
+  public:
+
+    typedef ImageContainerByBricks<TDomain,TValue,TBrickSide> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT(( CDomain<TDomain> ));
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    /// static constants
+    static const typename Domain::Dimension dimension = Domain::Space::dimension;
+    static const unsigned int brickSide = TBrickSide;
+    BOOST_STATIC_ASSERT(( ( TBrickSide > 0 ) && ( ( TBrickSide & ( TBrickSide - 1 ) ) == 0 ) ));
+
+    /// range of values
+    BOOST_CONCEPT_ASSERT(( CLabel<TValue> ));
+    typedef TValue Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+
+    /// output iterator
+    typedef SetValueIterator<Self> OutputIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The values are stored in a temporary file (in the
+     * directory given by the TMPDIR environment variable, or /tmp),
+     * removed when the last copy of the image is destroyed. They are
+     * all zero.
+     *
+     * @param aDomain the image domain.
+     * @param aCacheSize the maximal number of bricks in memory.
+     */
+    ImageContainerByBricks( const Domain & aDomain, Size aCacheSize = 256 );
+
+    /**
+     * Constructor. The values are stored in the file [aFilename].
+     *
+     * @param aDomain the image domain.
+     * @param aFilename the name of the file.
+     * @param create when 'true', the file is created (or truncated)
+     * and the values are all zero; otherwise the file must have been
+     * written by an image of same domain, value type and brick side.
+     * @param aCacheSize the maximal number of bricks in memory.
+     * @throw IOException if the file cannot be created or opened.
+     */
+    ImageContainerByBricks( const Domain & aDomain, const std::string & aFilename,
+                            bool create = true, Size aCacheSize = 256 );
+
+    /**
+     * Copy constructor. The copy shares the values of [other].
+     * @param other the object to clone.
+     */
+    ImageContainerByBricks( const ImageContainerByBricks & other );
+
+    /**
+     * Assignment. The image then shares the values of [other].
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    ImageContainerByBricks & operator= ( const ImageContainerByBricks & other );
+
+    /**
+     * Destructor.
+     */
+    ~ImageContainerByBricks();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Set a value on an Image at a position specified by a Point.
+     *
+     * @pre @c aPoint must be a point in the image domain.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue( const Point & aPoint, const Value & aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the const range providing constant
+     * iterators to iterate over the values of the image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing constant iterators
+     * and output iterators on the values of the image.
+     */
+    Range range();
+
+    /**
+     * @return an output iterator writing the values in the order of
+     * the domain.
+     */
+    OutputIterator outputIterator();
+
+    // ----------------------- Brick services ---------------------------------
+  public:
+
+    /**
+     * @return the number of bricks covering the domain.
+     */
+    Size nbBricks() const;
+
+    /**
+     * @param aBrick the index of a brick, less than nbBricks().
+     * @return the points of the domain lying in this brick.
+     */
+    Domain brickDomain( Size aBrick ) const;
+
+    /**
+     * @pre @c aPoint must be a point in the image domain.
+     * @param aPoint the point.
+     * @return the index of the brick containing it.
+     */
+    Size brickIndex( const Point & aPoint ) const;
+
+    /**
+     * @return the maximal number of bricks in memory.
+     */
+    Size cacheSize() const;
+
+    /**
+     * @return the number of bricks mapped into memory since the
+     * creation of the image (a measure of the locality of the
+     * accesses).
+     */
+    Size nbLoads() const;
+
+    /**
+     * @return the name of the file storing the values.
+     */
+    const std::string & filename() const;
+
+    /**
+     * Writes back to the file the bricks in memory.
+     */
+    void flush();
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /**
+     * The file of the bricks and the bricks in memory, shared by the
+     * copies of an image. The bricks in memory are kept in slots,
+     * chained from the most recently used to the least recently used.
+     */
+    struct Storage
+    {
+      Storage( const std::string & aFilename, bool temporary, bool create,
+               Size aNbBricks, Size aCacheSize );
+      ~Storage();
+
+      /// @return the values of brick [aBrick], mapping it if needed.
+      Value* values( Size aBrick );
+      /// Removes the slot [s] from the chain.
+      void unlink( int s );
+      /// Inserts the slot [s] at the front of the chain.
+      void pushFront( int s );
+      /// Unmaps every brick.
+      void clear();
+
+      std::string filename;
+      bool temporary;
+      boost::interprocess::file_mapping file;
+      /// size in bytes of a brick.
+      std::size_t brickBytes;
+      /// distance in bytes between two bricks in the file (a
+      /// multiple of the page size).
+      std::size_t stride;
+      /// the slot of each brick, or -1.
+      std::vector<int> slotOfBrick;
+      /// the brick of each slot.
+      std::vector<Size> brickOfSlot;
+      std::vector<boost::interprocess::mapped_region*> regions;
+      std::vector<int> previous;
+      std::vector<int> next;
+      int head;
+      int tail;
+      Size nbUsed;
+      Size nbLoads;
+      /// last brick accessed and its values.
+      Size lastBrick;
+      Value* lastValues;
+    };
+
+    /// the image domain.
+    Domain myDomain;
+    /// the number of bricks along each axis.
+    Size myNbBricks[ dimension ];
+    /// the maximal number of bricks in memory.
+    Size myCacheSize;
+    /// the storage, shared by the copies.
+    CountedPtr<Storage> myStorage;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Computes myNbBricks.
+    void initGrid();
+
+    /**
+     * @param aPoint a point of the domain.
+     * @param aBrick (returns) the brick containing it.
+     * @param anOffset (returns) its offset in the brick.
+     */
+    void locate( const Point & aPoint, Size & aBrick, Size & anOffset ) const;
+
+    /// @return a new temporary file name.
+    static std::string temporaryFilename();
+
+  }; // end of class ImageContainerByBricks
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByBricks'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByBricks' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue, unsigned int TBrickSide>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ImageContainerByBricks<TDomain,TValue,TBrickSide> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerByBricks.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByBricks_h
+
+#undef ImageContainerByBricks_RECURSES
+#endif // else defined(ImageContainerByBricks_RECURSES)
@@ -0,0 +1,157 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageHistogram.h
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module ImageHistogram.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageHistogram_RECURSES)
+#error Recursive header files inclusion detected in ImageHistogram.h
+#else // defined(ImageHistogram_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageHistogram_RECURSES
+
+#if !defined ImageHistogram_h
+/** Prevents repeated inclusion of headers. */
+#define ImageHistogram_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // struct ImageHistogram
+  /**
+   * Description of struct 'ImageHistogram' <p>
+   * \brief Aim: Computes the histogram of the values of an 8 bits
+   * image and the thresholds given by the Otsu method (and its
+   * multi-level extension).
+   *
+   * The histogram has 256 bins, one per value. For an
+   * ImageContainerBySTLVector, the values are read directly in its
+   * buffer, with four sub-histograms so that consecutive equal
+   * values do not wait for each other's increment, and with several
+   * threads when DGtal is built WITH_OPENMP.
+   *
+   *  @code
+   *  typedef ImageSelector < Z2i::Domain, unsigned char>::Type Image;
+   *  Image image = PNMReader<Image>::importPGM( filename );
+   *  ImageHistogram::Histogram histo;
+   *  ImageHistogram::compute( image, histo );
+   *  unsigned int t = ImageHistogram::otsuThreshold( histo );
+   *  @endcode
+   */
+  struct ImageHistogram
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// The number of pixels of each value.
+    typedef std::vector<DGtal::uint64_t> Histogram;
+
+    /// The number of bins of a histogram.
+    enum { nbBins = 256 };
+
+    /**
+     * Computes the histogram of the values of a range.
+     *
+     * @param first the first value.
+     * @param last after the last value.
+     * @param histo (returns) the histogram (with nbBins bins).
+     * @param nbThreads the number of threads (used only WITH_OPENMP).
+     */
+    static void compute( const unsigned char* first, const unsigned char* last,
+                         Histogram & histo, int nbThreads = 1 );
+
+    /**
+     * Computes the histogram of the values of an image stored in a
+     * vector: its buffer is read directly.
+     *
+     * @param image any image of unsigned char values stored in a vector.
+     * @param histo (returns) the histogram (with nbBins bins).
+     * @param nbThreads the number of threads (used only WITH_OPENMP).
+     */
+    template <typename TDomain>
+    static void compute( const ImageContainerBySTLVector<TDomain, unsigned char> & image,
+                         Histogram & histo, int nbThreads = 1 );
+
+    /**
+     * Computes the histogram of the values of any image, through its
+     * constRange(). The values must be in [0,nbBins[.
+     *
+     * @param image any model of CConstImage.
+     * @param histo (returns) the histogram (with nbBins bins).
+     * @param nbThreads unused.
+     */
+    template <typename TImage>
+    static void compute( const TImage & image, Histogram & histo,
+                         int nbThreads = 1 );
+
+    /**
+     * The Otsu threshold: the value t maximizing the between-class
+     * variance of the classes [0,t] and [t+1,nbBins-1] (the greatest
+     * one for equal variances).
+     *
+     * @param histo any histogram.
+     * @return the threshold t (0 if the histogram has less than two
+     * non-empty bins).
+     */
+    static unsigned int otsuThreshold( const Histogram & histo );
+
+    /**
+     * The multi-level Otsu thresholds: the values t1 < ... < tn
+     * maximizing the between-class variance of the n+1 classes
+     * [0,t1], [t1+1,t2], ..., [tn+1,nbBins-1]. It is computed by
+     * dynamic programming in O(n.nbBins^2).
+     *
+     * @param histo any histogram.
+     * @param nbThresholds the number n of thresholds (at least 1).
+     * @return the thresholds in increasing order.
+     */
+    static std::vector<unsigned int> multiOtsuThresholds( const Histogram & histo,
+                                                          unsigned int nbThresholds );
+
+  }; // end of struct ImageHistogram
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageHistogram.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageHistogram_h
+
+#undef ImageHistogram_RECURSES
+#endif // else defined(ImageHistogram_RECURSES)
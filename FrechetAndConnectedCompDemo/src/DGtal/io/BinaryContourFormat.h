@@ -0,0 +1,118 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BinaryContourFormat.h
+ *
+ * @date 2026/10/17
+ *
+ * Header file for the binary contour format shared by
+ * BinaryContourReader and BinaryContourWriter.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BinaryContourFormat_RECURSES)
+#error Recursive header files inclusion detected in BinaryContourFormat.h
+#else // defined(BinaryContourFormat_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BinaryContourFormat_RECURSES
+
+#if !defined BinaryContourFormat_h
+/** Prevents repeated inclusion of headers. */
+#define BinaryContourFormat_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // struct BinaryContourFormat
+  /**
+   * Description of struct 'BinaryContourFormat' <p>
+   * \brief Aim: Describes a compact binary file storing a list of 2D
+   * digital contours (sequences of points with integer coordinates).
+   *
+   * The file is made of:
+   * - a Header;
+   * - a table of Header::nbContours Entry, one per contour;
+   * - the points of each contour, starting at Entry::offset bytes
+   *   from the beginning of the file (a multiple of 4), either as
+   *   nbPoints pairs of int32 (RAW) or as the first point as two
+   *   int32 followed by the nbPoints-1 Freeman codes of the
+   *   4-connected steps, 2 bits each, 4 per byte starting with the
+   *   low bits (FREEMAN).
+   *
+   * All values are written with the byte order of the machine (little
+   * endian on the usual ones), so that a reader can use the points of
+   * a memory-mapped file in place.
+   *
+   * @see BinaryContourReader, BinaryContourWriter
+   */
+  struct BinaryContourFormat
+  {
+    /// The encodings of the points of a contour.
+    enum Encoding { RAW = 0, FREEMAN = 1 };
+
+    /// First bytes of the file.
+    struct Header
+    {
+      char magic[ 4 ];
+      DGtal::uint32_t version;
+      DGtal::uint32_t nbContours;
+      DGtal::uint32_t reserved;
+    };
+
+    /// Description of a contour in the table.
+    struct Entry
+    {
+      DGtal::uint64_t offset;
+      DGtal::uint32_t nbPoints;
+      DGtal::uint32_t encoding;
+    };
+
+    /// @return the value of Header::magic.
+    static const char* magic() { return "DGCT"; }
+
+    /// @return the version written by BinaryContourWriter.
+    static DGtal::uint32_t version() { return 1; }
+
+    /**
+       @param nbPoints a number of points (at least 1).
+       @return the number of bytes of a FREEMAN contour.
+    */
+    static DGtal::uint64_t freemanSize( DGtal::uint32_t nbPoints )
+    {
+      return 8 + ( nbPoints + 2 ) / 4;
+    }
+
+  }; // end of struct BinaryContourFormat
+
+} // namespace DGtal
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BinaryContourFormat_h
+
+#undef BinaryContourFormat_RECURSES
+#endif // else defined(BinaryContourFormat_RECURSES)
@@ -88,7 +88,7 @@ An object x satisfying this concept may then be used as:
 ### Invariants
    
 ### Models
-    ArimeticalDSS, FreemanChain, HyperRectDomain, ImageContainerByHashTree, ImageContainerBySTLVector, PointVector, DigitalSetBySTLSet,DigitalSetBySTLVector, Object
+    ArimeticalDSS, FreemanChain, HyperRectDomain, ImageContainerByHashTree, ImageContainerBySTLVector, PointVector, DigitalSetBySTLSet,DigitalSetBySTLVector, DigitalSetByBitGrid, Object
    
 ### Notes
     @todo ImageContainerByHashTree does not implement setStyle(display &).
@@ -49,6 +49,7 @@
 #include "DGtal/shapes/fromPoints/CircleFrom3Points.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+#include "DGtal/kernel/sets/DigitalSetByBitGrid.h"
 #include "DGtal/geometry/curves/GridCurve.h"
 #include "DGtal/geometry/curves/FP.h"
 #include "DGtal/geometry/curves/FreemanChain.h"
@@ -140,6 +141,12 @@ static void draw( DGtal::Board2D & board, const DGtal::DigitalSetBySTLSet<Domain
 template<typename Domain>
 static void draw( DGtal::Board2D & board, const DGtal::DigitalSetBySTLVector<Domain> & );
 // DigitalSetBySTLVector
+
+
+// DigitalSetByBitGrid
+template<typename Domain>
+static void draw( DGtal::Board2D & board, const DGtal::DigitalSetByBitGrid<Domain> & );
+// DigitalSetByBitGrid
     
     
 // FP
@@ -175,8 +182,8 @@ static void draw(DGtal::Board2D & aBoard, const DGtal::GeometricalDCA<TConstIter
 
 
 //FrechetShortcut
-template <typename TIterator, typename TInteger>
-static  void draw(DGtal::Board2D & aBoard, const DGtal::FrechetShortcut<TIterator,TInteger> & );
+template <typename TIterator, typename TInteger, typename TConePolicy>
+static  void draw(DGtal::Board2D & aBoard, const DGtal::FrechetShortcut<TIterator,TInteger,TConePolicy> & );
 //FrechetShortcut
 
 
@@ -48,6 +48,7 @@
 #include "DGtal/geometry/curves/ArithmeticalDSS3d.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+#include "DGtal/kernel/sets/DigitalSetByBitGrid.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/topology/KhalimskySpaceND.h"
 #include "DGtal/topology/Object.h"
@@ -165,6 +166,28 @@ namespace DGtal
     // DigitalSetBySTLVector
     
     
+    // DigitalSetByBitGrid
+    /**
+     * Default drawing style object.
+     * @return the dyn. alloc. default style for this object.
+     */
+    template<typename Domain>
+    static DGtal::DrawableWithDisplay3D * defaultStyle( std::string, const DGtal::DigitalSetByBitGrid<Domain> & );
+
+    template<typename Domain>
+    static void drawAsPavingTransparent( Display3D & display, const DGtal::DigitalSetByBitGrid<Domain> & );
+
+    template<typename Domain>
+    static void drawAsPaving( Display3D & display, const DGtal::DigitalSetByBitGrid<Domain> & );
+    
+    template<typename Domain>
+    static void drawAsGrid( Display3D & display, const DGtal::DigitalSetByBitGrid<Domain> & );
+
+    template<typename Domain>
+    static void draw( Display3D & display, const DGtal::DigitalSetByBitGrid<Domain> & );
+    // DigitalSetByBitGrid
+    
+    
     // HyperRectDomain
     /**
      * Default drawing style object.
@@ -0,0 +1,208 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file VoxelCodec.h
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module VoxelCodec.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(VoxelCodec_RECURSES)
+#error Recursive header files inclusion detected in VoxelCodec.h
+#else // defined(VoxelCodec_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define VoxelCodec_RECURSES
+
+#if !defined VoxelCodec_h
+/** Prevents repeated inclusion of headers. */
+#define VoxelCodec_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // struct VoxelCodec
+  /**
+   * Description of struct 'VoxelCodec' <p>
+   * \brief Aim: Converts rows of image values from and to the raw
+   * voxels of the Raw and Vol files, shared by RawReader, VolReader,
+   * RawWriter and VolWriter.
+   *
+   * A voxel has 1 or 2 bytes, the most significant one first. A row
+   * of voxels (first coordinate varying) may also be compressed with
+   * the PackBits run-length encoding: a control byte n followed
+   * either by n+1 literal voxels (n < 128), or by one voxel repeated
+   * 257-n times (n > 128), the control byte 128 being ignored. Each
+   * row is encoded on its own, so that a reader never needs more than
+   * one row of buffer.
+   *
+   * The images stored in a vector (ImageContainerBySTLVector) are
+   * read and written in place, a row at a time; the other images go
+   * through a row buffer and their setValue/operator().
+   *
+   * @see VolReader, VolWriter, RawReader, RawWriter
+   */
+  struct VoxelCodec
+  {
+    /**
+     * @param image any image.
+     * @return a pointer to its values in the order of its domain, or
+     * 0 when the image does not store its values contiguously.
+     */
+    template <typename TImage>
+    static typename TImage::Value* data( TImage & image );
+
+    /// Specialization for the images stored in a vector.
+    template <typename TDomain, typename TValue>
+    static TValue* data( ImageContainerBySTLVector<TDomain,TValue> & image );
+
+    /// Constant version.
+    template <typename TImage>
+    static const typename TImage::Value* data( const TImage & image );
+
+    /// Constant specialization for the images stored in a vector.
+    template <typename TDomain, typename TValue>
+    static const TValue* data( const ImageContainerBySTLVector<TDomain,TValue> & image );
+
+    /**
+     * Decodes [n] raw voxels.
+     *
+     * @param src the n * voxelSize bytes of the voxels.
+     * @param n the number of voxels.
+     * @param voxelSize the size of a voxel, 1 or 2.
+     * @param msbFirst when 'true', the most significant byte of a 2
+     * bytes voxel comes first.
+     * @param dst (returns) the n values.
+     */
+    template <typename TValue>
+    static void decode( const unsigned char* src, std::size_t n,
+                        unsigned int voxelSize, bool msbFirst, TValue* dst );
+
+    /// Specialization for unsigned char values: 1 byte voxels are copied with memcpy.
+    static void decode( const unsigned char* src, std::size_t n,
+                        unsigned int voxelSize, bool msbFirst,
+                        unsigned char* dst );
+
+    /**
+     * Encodes [n] values as raw voxels, most significant byte first.
+     *
+     * @param src the n values.
+     * @param n the number of values.
+     * @param voxelSize the size of a voxel, 1 or 2.
+     * @param aFunctor the functor casting the values to the voxels.
+     * @param dst (returns) the n * voxelSize bytes of the voxels.
+     */
+    template <typename TValue, typename TFunctor>
+    static void encode( const TValue* src, std::size_t n,
+                        unsigned int voxelSize, const TFunctor & aFunctor,
+                        unsigned char* dst );
+
+    /**
+     * Appends the PackBits encoding of a row of raw voxels.
+     *
+     * @param src the n * voxelSize bytes of the voxels.
+     * @param n the number of voxels.
+     * @param voxelSize the size of a voxel, 1 or 2.
+     * @param out (modified) the bytes of the encoding are appended to it.
+     */
+    static void pack( const unsigned char* src, std::size_t n,
+                      unsigned int voxelSize,
+                      std::vector<unsigned char> & out );
+
+    /**
+     * Decodes a row of raw voxels encoded with PackBits.
+     *
+     * @param src the beginning of the encoding.
+     * @param end the end of the available bytes.
+     * @param n the number of voxels of the row.
+     * @param voxelSize the size of a voxel, 1 or 2.
+     * @param dst (returns) the n * voxelSize bytes of the voxels.
+     * @return the end of the encoding of the row, or 0 if the
+     * encoding is truncated or does not give n voxels.
+     */
+    static const unsigned char* unpack( const unsigned char* src,
+                                        const unsigned char* end,
+                                        std::size_t n, unsigned int voxelSize,
+                                        unsigned char* dst );
+
+    /**
+     * Reads the values of an image, in the order of its domain, from
+     * raw voxels (possibly compressed row by row).
+     *
+     * @param src (modified) the beginning of the voxels, then the end
+     * of the voxels read.
+     * @param end the end of the available bytes.
+     * @param voxelSize the size of a voxel, 1 or 2.
+     * @param msbFirst when 'true', the most significant byte of a 2
+     * bytes voxel comes first.
+     * @param compressed when 'true', the rows are encoded with PackBits.
+     * @param image (modified) the image, whose domain gives the
+     * number of voxels.
+     * @return 'false' if there are not enough voxels.
+     */
+    template <typename TImage>
+    static bool readImage( const unsigned char* & src, const unsigned char* end,
+                           unsigned int voxelSize, bool msbFirst,
+                           bool compressed, TImage & image );
+
+    /**
+     * Writes the values of an image, in the order of its domain, as
+     * raw voxels (possibly compressed row by row), most significant
+     * byte first.
+     *
+     * @param out the output stream, opened in binary mode.
+     * @param image the image.
+     * @param voxelSize the size of a voxel, 1 or 2.
+     * @param aFunctor the functor casting the values to the voxels.
+     * @param compressed when 'true', the rows are encoded with PackBits.
+     * @return 'true' if no errors occur.
+     */
+    template <typename TImage, typename TFunctor>
+    static bool writeImage( std::ostream & out, const TImage & image,
+                            unsigned int voxelSize, const TFunctor & aFunctor,
+                            bool compressed );
+
+  }; // end of struct VoxelCodec
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/VoxelCodec.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined VoxelCodec_h
+
+#undef VoxelCodec_RECURSES
+#endif // else defined(VoxelCodec_RECURSES)
@@ -92,7 +92,7 @@ An object x satisfying this concept may then be used as:
  ### Invariants
    
  ### Models
-    ArithmeticalDSS, FreemanChain, HyperRectDomain, ImageContainerByHashTree, ImageContainerBySTLVector, PointVector, DigitalSetBySTLSet,DigitalSetBySTLVector, Object
+    ArithmeticalDSS, FreemanChain, HyperRectDomain, ImageContainerByHashTree, ImageContainerBySTLVector, PointVector, DigitalSetBySTLSet,DigitalSetBySTLVector, DigitalSetByBitGrid, Object
    
  ### Notes
     @todo ImageContainerByHashTree does not implement setStyle(Board2D &).
@@ -0,0 +1,210 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BinaryContourReader.h
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module BinaryContourReader
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BinaryContourReader_RECURSES)
+#error Recursive header files inclusion detected in BinaryContourReader.h
+#else // defined(BinaryContourReader_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BinaryContourReader_RECURSES
+
+#if !defined BinaryContourReader_h
+/** Prevents repeated inclusion of headers. */
+#define BinaryContourReader_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/io/BinaryContourFormat.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BinaryContourReader
+  /**
+   * Description of template class 'BinaryContourReader' <p>
+   * \brief Aim: Reads a list of 2D contours stored in the binary
+   * format described by BinaryContourFormat.
+   *
+   * The file is memory-mapped: opening it only reads the header, and
+   * each contour is decoded from the mapped memory on demand, with no
+   * parsing and no intermediate copy.
+   *
+   * @code
+   std::vector< std::vector<Z2i::Point> > contours =
+     BinaryContourReader<Z2i::Point>::getPolygonsFromFile( "contours.bin" );
+   // or, one contour at a time:
+   BinaryContourReader<Z2i::Point> reader( "contours.bin" );
+   std::vector<Z2i::Point> contour;
+   for ( unsigned int i = 0; i < reader.size(); ++i )
+     {
+       reader.getContour( i, contour );
+       ...
+     }
+   * @endcode
+   *
+   * @tparam TPoint the type of the points (2D with integer coordinates).
+   *
+   * @see BinaryContourWriter
+   */
+  template <typename TPoint>
+  class BinaryContourReader
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TPoint Point;
+
+    /**
+     * Constructor. Maps the file and checks its header and table.
+     * @param filename the name of a file written by BinaryContourWriter.
+     * Throws an IOException if the file can't be mapped or is not valid.
+     */
+    BinaryContourReader( const std::string & filename );
+
+    /**
+     * Destructor. Unmaps the file.
+     */
+    ~BinaryContourReader();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /// @return the number of contours.
+    unsigned int size() const;
+
+    /**
+     * @param i the index of a contour (less than size()).
+     * @return its number of points.
+     */
+    unsigned int nbPoints( unsigned int i ) const;
+
+    /**
+     * Decodes a contour.
+     * @param i the index of a contour (less than size()).
+     * @param contour (modified) the points of the contour.
+     */
+    void getContour( unsigned int i, std::vector<Point> & contour ) const;
+
+    /**
+     * Imports all the contours of a file.
+     * @param filename the name of a file written by BinaryContourWriter.
+     * @return a vector containing the vector of polygons.
+     */
+    static std::vector< std::vector<Point> >
+    getPolygonsFromFile( const std::string & filename );
+
+    /**
+     * @param filename any filename.
+     * @return 'true' if the file starts like a binary contour file.
+     */
+    static bool isBinaryContourFile( const std::string & filename );
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The mapped file.
+    boost::interprocess::file_mapping myFile;
+
+    /// The mapped memory.
+    boost::interprocess::mapped_region myRegion;
+
+    /// The beginning of the mapped memory.
+    const char* myData;
+
+    /// The number of contours.
+    DGtal::uint32_t myNbContours;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * @param i the index of a contour.
+     * @return its entry in the table.
+     */
+    BinaryContourFormat::Entry entry( unsigned int i ) const;
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    BinaryContourReader ( const BinaryContourReader & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    BinaryContourReader & operator= ( const BinaryContourReader & other );
+
+  }; // end of class BinaryContourReader
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BinaryContourReader'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BinaryContourReader' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPoint>
+  std::ostream&
+  operator<< ( std::ostream & out, const BinaryContourReader<TPoint> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/BinaryContourReader.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BinaryContourReader_h
+
+#undef BinaryContourReader_RECURSES
+#endif // else defined(BinaryContourReader_RECURSES)
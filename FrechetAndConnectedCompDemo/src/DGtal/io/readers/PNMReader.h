@@ -42,6 +42,7 @@
 // Inclusions
 #include <iostream>
 #include "DGtal/base/Common.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 //////////////////////////////////////////////////////////////////////////////
 
 #ifdef _MSC_VER
@@ -110,6 +111,13 @@ namespace DGtal
      * corner image point (default) else the center of image
      * coordinate will be the top left of the image (not usual).
      * @return an instance of the ImageContainer.
+     *
+     * The file is memory-mapped. The raw (P5) rows are copied as a
+     * whole into the storage of an ImageContainerBySTLVector (with
+     * memcpy for unsigned char values), the ASCII (P2) values are
+     * parsed without iostream. Other containers are filled with
+     * setValue. A maximal value greater than 255 means two bytes per
+     * pixel, most significant first, in a P5 file.
      */
     static  ImageContainer importPGM(const std::string & aFilename, 
                                      bool topbotomOrder = true) ;
@@ -124,7 +132,50 @@ namespace DGtal
      */
     static ImageContainer importPGM3D(const std::string & aFilename) ;
     
-    
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Reads an unsigned integer of a PNM header, skipping the white
+     * spaces and the comments before it.
+     *
+     * @param p (modified) the current position, just after the value.
+     * @param end the end of the file.
+     * @param value (returns) the value read.
+     * @return 'true' if a value was read.
+     */
+    static bool readHeaderValue( const char* & p, const char* end,
+                                 unsigned int & value );
+
+    /**
+     * @param image an image of domain [0,w-1]x[0,h-1].
+     * @param y a row of the image.
+     * @param w the width of the image.
+     * @return a pointer to the w values of the row, or 0 when the
+     * image does not store its rows contiguously.
+     */
+    template <typename TImage>
+    static typename TImage::Value* rowData( TImage & image,
+                                            unsigned int y, unsigned int w );
+
+    /// Specialization for the images stored in a vector.
+    template <typename TDomain, typename TValue>
+    static TValue* rowData( ImageContainerBySTLVector<TDomain,TValue> & image,
+                            unsigned int y, unsigned int w );
+
+    /**
+     * Copies a row of raw 8 bits values.
+     * @param src the w bytes of the row.
+     * @param w the width of the row.
+     * @param dst the w values of the row.
+     */
+    template <typename TValue>
+    static void copyRawRow( const unsigned char* src, unsigned int w,
+                            TValue* dst );
+
+    /// Specialization for unsigned char values: the row is copied with memcpy.
+    static void copyRawRow( const unsigned char* src, unsigned int w,
+                            unsigned char* dst );
     
  }; // end of class  PNMReader
 
@@ -44,6 +44,7 @@
 #include <string>
 #include <cstdio>
 #include "DGtal/base/Common.h"
+#include "DGtal/io/VoxelCodec.h"
 #include <boost/static_assert.hpp>
 //////////////////////////////////////////////////////////////////////////////
 
@@ -103,6 +104,35 @@ namespace DGtal
      */
     static ImageContainer importRaw8(const std::string & filename,
              const Vector & extent) ;
+
+    /** 
+     * Imports a Raw (16bits, most significant byte first) into an
+     * instance of the template parameter ImageContainer.
+     * 
+     * @param filename the file name to import.
+     * @param extent the size of the raw data set.
+     * @return an instance of the ImageContainer.
+     */
+    static ImageContainer importRaw16(const std::string & filename,
+             const Vector & extent) ;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /** 
+     * Imports the raw voxels of a memory-mapped file, a row at a
+     * time, straight into the storage of an ImageContainerBySTLVector
+     * (see VoxelCodec). The file may be longer than the data set.
+     * 
+     * @param filename the file name to import.
+     * @param extent the size of the raw data set.
+     * @param voxelSize the size of a voxel, 1 or 2.
+     * @return an instance of the ImageContainer.
+     * @throw IOException if the file cannot be read, or if its voxels
+     * are larger than the values of the image.
+     */
+    static ImageContainer importRaw(const std::string & filename,
+             const Vector & extent, unsigned int voxelSize) ;
     
   }; // end of class RawReader
 
@@ -44,6 +44,7 @@
 #include <string>
 #include <cstdio>
 #include "DGtal/base/Common.h"
+#include "DGtal/io/VoxelCodec.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -95,8 +96,19 @@ namespace DGtal
      * Main method to import a Vol into an instance of the 
      * template parameter ImageContainer.
      * 
+     * The file is memory-mapped and its voxels are decoded a row at a
+     * time, straight into the storage of an ImageContainerBySTLVector
+     * (with memcpy for unsigned char values); other containers are
+     * filled with setValue. Voxels of 1 or 2 bytes are read
+     * (Voxel-Size), the most significant byte first unless
+     * Voxel-Endian starts with 1, and the field "Compression: RLE"
+     * means rows encoded with PackBits (see VoxelCodec).
+     *
      * @param filename the file name to import.
      * @return an instance of the ImageContainer.
+     * @throw IOException if the file cannot be read, or if its voxels
+     * are larger than the values of the image (e.g. 2 bytes voxels in
+     * an image of unsigned char).
      */
     static ImageContainer importVol(const std::string & filename) ;
     
@@ -104,7 +116,6 @@ namespace DGtal
     
   private:
 
-    typedef unsigned char voxel;
     // This class help us to associate a field type and his value.
     // An object is a pair (type, value). You can copy and assign
     // such objects.
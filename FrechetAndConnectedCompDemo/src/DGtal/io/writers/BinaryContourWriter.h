@@ -0,0 +1,126 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BinaryContourWriter.h
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module BinaryContourWriter
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BinaryContourWriter_RECURSES)
+#error Recursive header files inclusion detected in BinaryContourWriter.h
+#else // defined(BinaryContourWriter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BinaryContourWriter_RECURSES
+
+#if !defined BinaryContourWriter_h
+/** Prevents repeated inclusion of headers. */
+#define BinaryContourWriter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/io/BinaryContourFormat.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template struct BinaryContourWriter
+  /**
+   * Description of template struct 'BinaryContourWriter' <p>
+   * \brief Aim: Exports a list of 2D contours in the binary format
+   * described by BinaryContourFormat.
+   *
+   * The 4-connected contours (e.g. the ones given by
+   * Surfaces::extractAllPointContours4C) are Freeman coded on 2 bits
+   * per point, the other ones are written as pairs of int32.
+   *
+   * @code
+   std::vector< std::vector<Z2i::Point> > contours;
+   ...
+   BinaryContourWriter<Z2i::Point>::exportContours( "contours.bin", contours );
+   * @endcode
+   *
+   * @tparam TPoint the type of the points (2D with integer coordinates).
+   *
+   * @see BinaryContourReader
+   */
+  template <typename TPoint>
+  struct BinaryContourWriter
+  {
+    // ----------------------- Standard services ------------------------------
+    typedef TPoint Point;
+
+    /**
+     * Exports contours to a stream opened in binary mode.
+     *
+     * @param out the output stream.
+     * @param contours the contours.
+     * @param freemanCoding when 'true', the 4-connected contours are
+     * Freeman coded.
+     * @return true if no errors occur.
+     */
+    static bool exportContours( std::ostream & out,
+                                const std::vector< std::vector<Point> > & contours,
+                                bool freemanCoding = true );
+
+    /**
+     * Exports contours to a file.
+     *
+     * @param filename name of the output file.
+     * @param contours the contours.
+     * @param freemanCoding when 'true', the 4-connected contours are
+     * Freeman coded.
+     * @return true if no errors occur.
+     */
+    static bool exportContours( const std::string & filename,
+                                const std::vector< std::vector<Point> > & contours,
+                                bool freemanCoding = true );
+
+    /**
+     * @param contour any contour.
+     * @return 'true' if the contour is not empty and each point is
+     * 4-adjacent to the previous one.
+     */
+    static bool is4Connected( const std::vector<Point> & contour );
+
+  }; // end of struct BinaryContourWriter
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/writers/BinaryContourWriter.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BinaryContourWriter_h
+
+#undef BinaryContourWriter_RECURSES
+#endif // else defined(BinaryContourWriter_RECURSES)
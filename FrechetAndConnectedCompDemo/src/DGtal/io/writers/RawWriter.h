@@ -47,6 +47,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
 #include "DGtal/base/BasicFunctors.h"
+#include "DGtal/io/VoxelCodec.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -59,7 +60,9 @@ namespace DGtal
    * \brief Aim: Raw binary export of an Image.
    *
    * A functor can be specified to convert image values to raw values
-   * (unsigned char for exportRaw8).
+   * (unsigned char for exportRaw8, 16 bits unsigned integers for
+   * exportRaw16). The values are written a row at a time, read in
+   * place from an ImageContainerBySTLVector (see VoxelCodec).
    *
    * @tparam TImage the Image type.
    * @tparam TFunctor the type of functor used in the export.
@@ -73,7 +76,6 @@ namespace DGtal
     typedef typename TImage::Value Value;
     typedef TFunctor Functor;
     
-    BOOST_CONCEPT_ASSERT((  CUnaryFunctor<TFunctor, Value, unsigned char> )) ;    
     
     /** 
      * Export an Image to  Raw format (8bits, unsigned char).
@@ -85,6 +87,31 @@ namespace DGtal
      */
     static bool exportRaw8(const std::string & filename, const Image &aImage, 
 			   const Functor & aFunctor = Functor());
+
+    /** 
+     * Export an Image to  Raw format (16bits, most significant byte first).
+     *
+     * @param filename name of the output file
+     * @param aImage the image to export
+     * @param aFunctor functor used to cast image values
+     * @return true if no errors occur.
+     */
+    static bool exportRaw16(const std::string & filename, const Image &aImage, 
+			    const Functor & aFunctor = Functor());
+
+  private:
+
+    /** 
+     * Export an Image to  Raw format.
+     *
+     * @param filename name of the output file
+     * @param aImage the image to export
+     * @param aFunctor functor used to cast image values
+     * @param voxelSize the size of a value, 1 or 2.
+     * @return true if no errors occur.
+     */
+    static bool exportRaw(const std::string & filename, const Image &aImage, 
+			  const Functor & aFunctor, unsigned int voxelSize);
     
   };
 }//namespace
@@ -0,0 +1,284 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SurfelMeshWriter.h
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module SurfelMeshWriter
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SurfelMeshWriter_RECURSES)
+#error Recursive header files inclusion detected in SurfelMeshWriter.h
+#else // defined(SurfelMeshWriter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SurfelMeshWriter_RECURSES
+
+#if !defined SurfelMeshWriter_h
+/** Prevents repeated inclusion of headers. */
+#define SurfelMeshWriter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <cstdio>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <boost/unordered_map.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/io/Color.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SurfelMeshWriter
+  /**
+   * Description of template class 'SurfelMeshWriter' <p>
+   * \brief Aim: Exports sets of 3D surfels as an indexed mesh (OFF
+   * or binary PLY), one quad per surfel, the quads sharing their
+   * vertices.
+   *
+   * The surfels are given by components (e.g. the connected
+   * components given by Surfaces::extractAllConnectedSCell). The
+   * pointels are indexed by their Khalimsky coordinates in a hash
+   * map, and the faces are streamed to a temporary file as the
+   * components are added, so that the surfels need not be kept. The
+   * color of each face is given at export time by a color map on the
+   * index of its component.
+   *
+   * The quads are the ones of the "Basic" mode of Display3D (a
+   * surfel between the spels p and p+e_k is the unit square at
+   * p + 0.5 e_k), but they are oriented consistently: the normal of a
+   * face points away from the direct incident spel of its surfel,
+   * i.e. outside the set for the surfels given by
+   * Surfaces::extractAllConnectedSCell.
+   *
+   * @code
+   SurfelMeshWriter<Z3i::KSpace> writer( K );
+   Surfaces<Z3i::KSpace>::extractAllConnectedSCell( writer.inserter(), K, sAdj, predicate );
+   GradientColorMap<long> gradient( 0, writer.nbComponents() );
+   ...
+   writer.exportMesh( "output.ply", gradient );
+   * @endcode
+   *
+   * @tparam TKSpace a 3D Khalimsky space.
+   *
+   * @see MeshWriter, Display3D
+   */
+  template <typename TKSpace>
+  class SurfelMeshWriter
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TKSpace KSpace;
+    typedef typename KSpace::SCell SCell;
+    typedef typename KSpace::Point Point;
+    BOOST_STATIC_ASSERT( KSpace::dimension == 3 );
+
+    /**
+     * Output iterator adding each assigned vector of surfels as a
+     * component of the mesh (as std::back_insert_iterator does for a
+     * container).
+     */
+    class ComponentInserter
+      : public std::iterator<std::output_iterator_tag, void, void, void, void>
+    {
+    public:
+      /// @param aWriter the writer receiving the components.
+      ComponentInserter( SurfelMeshWriter & aWriter ) : myWriter( &aWriter ) {}
+      /// Adds a component.
+      ComponentInserter & operator=( const std::vector<SCell> & aComponent )
+      {
+        myWriter->addComponent( aComponent.begin(), aComponent.end() );
+        return *this;
+      }
+      ComponentInserter & operator*() { return *this; }
+      ComponentInserter & operator++() { return *this; }
+      ComponentInserter & operator++( int ) { return *this; }
+    private:
+      SurfelMeshWriter* myWriter;
+    };
+
+    /**
+     * Constructor.
+     * @param aKSpace the space of the surfels.
+     */
+    SurfelMeshWriter( const KSpace & aKSpace );
+
+    /**
+     * Destructor. Removes the temporary file of the faces.
+     */
+    ~SurfelMeshWriter();
+
+    /**
+     * Adds a component to the mesh.
+     * @tparam TIterator an iterator on SCell (surfels).
+     * @param itb begin iterator on the surfels.
+     * @param ite end iterator on the surfels.
+     */
+    template <typename TIterator>
+    void addComponent( TIterator itb, TIterator ite );
+
+    /**
+     * @return an output iterator adding each component assigned to it.
+     */
+    ComponentInserter inserter();
+
+    /// @return the number of components.
+    unsigned int nbComponents() const;
+
+    /// @return the number of (distinct) vertices.
+    unsigned int nbVertices() const;
+
+    /// @return the number of faces (the number of surfels).
+    DGtal::uint64_t nbFaces() const;
+
+    /**
+     * Exports the mesh in the OFF format, with the face colors.
+     * @param out the output stream.
+     * @param aColorMap a functor giving the Color of a component
+     * index, in [0,nbComponents()[.
+     * @return 'true' if the mesh was written.
+     */
+    template <typename TColorMap>
+    bool exportOFF( std::ostream & out, const TColorMap & aColorMap ) const;
+
+    /**
+     * Exports the mesh in the binary PLY format (with the byte order
+     * of the machine), with the face colors.
+     * @param out the output stream, opened in binary mode.
+     * @param aColorMap a functor giving the Color of a component
+     * index, in [0,nbComponents()[.
+     * @return 'true' if the mesh was written.
+     */
+    template <typename TColorMap>
+    bool exportPLY( std::ostream & out, const TColorMap & aColorMap ) const;
+
+    /**
+     * Exports the mesh in a file, in the PLY format if its extension
+     * is "ply" and in the OFF format otherwise.
+     * @param aFilename the name of the file.
+     * @param aColorMap a functor giving the Color of a component index.
+     * @return 'true' if the mesh was written.
+     */
+    template <typename TColorMap>
+    bool exportMesh( const std::string & aFilename,
+                     const TColorMap & aColorMap ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// A face as stored in the temporary file.
+    struct Face
+    {
+      DGtal::uint32_t vertices[ 4 ];
+      DGtal::uint32_t component;
+    };
+
+    /// The space of the surfels.
+    KSpace myKSpace;
+    /// The Khalimsky coordinates of the vertices.
+    std::vector<Point> myVertices;
+    /// The index of a vertex from its packed Khalimsky coordinates.
+    boost::unordered_map<DGtal::uint64_t, DGtal::uint32_t> myVertexIndex;
+    /// The temporary file of the faces.
+    std::FILE* myFaces;
+    /// The number of faces.
+    DGtal::uint64_t myNbFaces;
+    /// The number of components.
+    unsigned int myNbComponents;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    SurfelMeshWriter ( const SurfelMeshWriter & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    SurfelMeshWriter & operator= ( const SurfelMeshWriter & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param kcoords the Khalimsky coordinates of a pointel.
+     * @return the index of its vertex, created if needed.
+     */
+    DGtal::uint32_t vertexIndex( const Point & kcoords );
+
+    /**
+     * Reads the faces of the temporary file by blocks.
+     * @param aFaces (returns) the next faces.
+     * @return 'false' when there are no more faces.
+     */
+    bool readFaces( std::vector<Face> & aFaces ) const;
+
+  }; // end of class SurfelMeshWriter
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SurfelMeshWriter'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SurfelMeshWriter' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const SurfelMeshWriter<TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/writers/SurfelMeshWriter.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SurfelMeshWriter_h
+
+#undef SurfelMeshWriter_RECURSES
+#endif // else defined(SurfelMeshWriter_RECURSES)
@@ -47,6 +47,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CUnaryFunctor.h"
 #include "DGtal/base/BasicFunctors.h"
+#include "DGtal/io/VoxelCodec.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -59,7 +60,12 @@ namespace DGtal
    * \brief Aim: Export a 3D Image using the Vol formats.
    *
    * A functor can be specified to convert image values to Vol values
-   * (unsigned char).
+   * (unsigned char, or 16 bits unsigned integers with exportVol16).
+   *
+   * The voxels are written a row at a time, read in place from an
+   * ImageContainerBySTLVector, and may be compressed row by row with
+   * PackBits (field "Compression: RLE", see VoxelCodec), which
+   * VolReader reads back.
    *
    * @tparam TImage the Image type.
    * @tparam TFunctor the type of functor used in the export.
@@ -72,7 +78,6 @@ namespace DGtal
     typedef typename TImage::Value Value;
     typedef TFunctor Functor;
     
-    BOOST_CONCEPT_ASSERT((  CUnaryFunctor<TFunctor, Value, unsigned char> )) ;    
     BOOST_STATIC_ASSERT(TImage::Domain::dimension == 3);
 
     /** 
@@ -81,10 +86,42 @@ namespace DGtal
      * @param filename name of the output file
      * @param aImage the image to export
      * @param aFunctor functor used to cast image values
+     * @param compressed when true, the rows are compressed with PackBits.
+     * @return true if no errors occur.
+     */
+    static bool exportVol(const std::string & filename, const Image &aImage, 
+			  const Functor & aFunctor = Functor(),
+			  bool compressed = false) ;
+
+    /** 
+     * Export an Image with the Vol format, with 16 bits voxels (most
+     * significant byte first).
+     * 
+     * @param filename name of the output file
+     * @param aImage the image to export
+     * @param aFunctor functor used to cast image values
+     * @param compressed when true, the rows are compressed with PackBits.
+     * @return true if no errors occur.
+     */
+    static bool exportVol16(const std::string & filename, const Image &aImage, 
+			    const Functor & aFunctor = Functor(),
+			    bool compressed = false) ;
+
+  private:
+
+    /** 
+     * Export an Image with the Vol format.
+     * 
+     * @param filename name of the output file
+     * @param aImage the image to export
+     * @param aFunctor functor used to cast image values
+     * @param voxelSize the size of a voxel, 1 or 2.
+     * @param compressed when true, the rows are compressed with PackBits.
      * @return true if no errors occur.
      */
     static bool exportVol(const std::string & filename, const Image &aImage, 
-			  const Functor & aFunctor = Functor()) ;
+			  const Functor & aFunctor, unsigned int voxelSize,
+			  bool compressed) ;
   };
 }//namespace
 
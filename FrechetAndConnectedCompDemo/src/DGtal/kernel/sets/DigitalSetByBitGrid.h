@@ -0,0 +1,469 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByBitGrid.h
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module DigitalSetByBitGrid.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByBitGrid_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByBitGrid.h
+#else // defined(DigitalSetByBitGrid_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByBitGrid_RECURSES
+
+#if !defined DigitalSetByBitGrid_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByBitGrid_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <string>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByBitGrid
+  /**
+   * Description of template class 'DigitalSetByBitGrid' <p> \brief
+   * Aim: Realizes the concept CDigitalSet by a grid of bits covering
+   * its domain, a HyperRectDomain.
+   *
+   * Each point of the domain has one bit, in the order of the domain
+   * (the first coordinate varies first), packed in 64 bits
+   * words. Membership tests, insertions and deletions are thus in
+   * constant time, the set takes one bit per point of its domain
+   * whatever its size, and the union, intersection, difference and
+   * complement of sets with the same domain are computed a word at a
+   * time. The points are visited in the order of the domain, the
+   * iterators skipping the empty words.
+   *
+   * The set is adequate for sets filling a significant part of their
+   * domain (e.g. the thresholded voxels of an image), whereas
+   * DigitalSetBySTLSet is better for small sets in a large domain.
+   *
+   * The iterators give the points by value: they are readable
+   * bidirectional iterators but not lvalue iterators.
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @see CDigitalSet, DigitalSetSelector
+   */
+  template <typename TDomain>
+  class DigitalSetByBitGrid
+  {
+  public:
+    typedef TDomain Domain;
+    typedef DigitalSetByBitGrid<Domain> Self;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    typedef typename Space::Dimension Dimension;
+    /// The type of the words of the grid.
+    typedef DGtal::uint64_t Word;
+
+    /**
+     * Bidirectional iterator on the points of the set, in the order of
+     * the domain.
+     */
+    class ConstIterator
+      : public boost::iterator_facade< ConstIterator, Point const,
+                                       boost::bidirectional_traversal_tag,
+                                       Point >
+    {
+    public:
+      ConstIterator() : mySet( 0 ), myIndex( 0 ) {}
+      ConstIterator( const Self* aSet, DGtal::uint64_t anIndex )
+        : mySet( aSet ), myIndex( anIndex ) {}
+      /// @return the index of the point in the grid.
+      DGtal::uint64_t index() const { return myIndex; }
+    private:
+      friend class boost::iterator_core_access;
+      Point dereference() const { return mySet->point( myIndex ); }
+      bool equal( const ConstIterator & other ) const
+      { return myIndex == other.myIndex; }
+      void increment() { myIndex = mySet->nextIndex( myIndex + 1 ); }
+      void decrement() { myIndex = mySet->previousIndex( myIndex ); }
+      const Self* mySet;
+      DGtal::uint64_t myIndex;
+    };
+    typedef ConstIterator Iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByBitGrid();
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any HyperRectDomain.
+     */
+    DigitalSetByBitGrid( const Domain & d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByBitGrid ( const DigitalSetByBitGrid & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitGrid & operator= ( const DigitalSetByBitGrid & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set if the point is not already in the
+     * set.
+     *
+     * @param p any digital point.
+     *
+     * @pre p should belong to the associated domain.
+     * @pre p should not belong to this.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     *
+     * @pre all points should belong to the associated domain.
+     * @pre each point should not belong to this.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     * @pre it should point on a valid element ( it != end() ).
+     * Note: other iterators stay valid.
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return a const iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @param p any digital point.
+     * @return an iterator pointing on [p] if found, otherwise end().
+     */
+    Iterator find( const Point & p );
+
+    /**
+     * @return a const iterator on the first element in this set.
+     * Note: linear in the number of leading empty words.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * @return an iterator on the first element in this set.
+     */
+    Iterator begin();
+
+    /**
+     * @return a iterator on the element after the last in this set.
+     */
+    Iterator end();
+
+    /**
+     * set union to left.
+     * @param aSet any other set.
+     */
+    DigitalSetByBitGrid<Domain> & operator+=
+    ( const DigitalSetByBitGrid<Domain> & aSet );
+
+    /**
+     * set difference to left.
+     * @param aSet any other set.
+     */
+    DigitalSetByBitGrid<Domain> & operator-=
+    ( const DigitalSetByBitGrid<Domain> & aSet );
+
+    /**
+     * set intersection to left.
+     * @param aSet any other set.
+     */
+    DigitalSetByBitGrid<Domain> & operator*=
+    ( const DigitalSetByBitGrid<Domain> & aSet );
+
+    // ----------------------- Model of CPointPredicate -----------------------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set.
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const DigitalSetByBitGrid<Domain> & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    /**
+     * @return the words of the grid: the bit i%64 of the word i/64 is
+     * the point of index i in the order of the domain.
+     */
+    const std::vector<Word> & words() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain.
+     */
+    const Domain & myDomain;
+
+    /**
+     * The lowest point of the grid (copied from the domain).
+     */
+    Point myLower;
+
+    /**
+     * The number of points of the grid along each direction.
+     */
+    DGtal::uint64_t myExtent[ Space::dimension ];
+
+    /**
+     * The number of points of the grid.
+     */
+    DGtal::uint64_t myNbBits;
+
+    /**
+     * The bits of the grid. The bits after myNbBits are always 0.
+     */
+    std::vector<Word> myWords;
+
+    /**
+     * The number of points of the set.
+     */
+    Size mySize;
+
+    // --------------- CDrawableWithBoard2D realization --------------------
+  public:
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByBitGrid();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param p any point.
+     * @param index (returns) the index of p in the grid, when it is inside.
+     * @return 'true' if p is inside the grid.
+     */
+    bool index( const Point & p, DGtal::uint64_t & index ) const;
+
+    /**
+     * @param index any index in the grid.
+     * @return the point of index [index].
+     */
+    Point point( DGtal::uint64_t index ) const;
+
+    /**
+     * @param index any index, at most myNbBits.
+     * @return the first index of the set from [index], myNbBits if none.
+     */
+    DGtal::uint64_t nextIndex( DGtal::uint64_t index ) const;
+
+    /**
+     * @param index any index, at most myNbBits.
+     * @return the last index of the set before [index], myNbBits if none.
+     */
+    DGtal::uint64_t previousIndex( DGtal::uint64_t index ) const;
+
+    /**
+     * @param aSet any other set.
+     * @return 'true' if [aSet] has the same grid as this.
+     */
+    bool sameGrid( const DigitalSetByBitGrid<Domain> & aSet ) const;
+
+    /**
+     * Counts the points of the set, and clears the bits after myNbBits.
+     */
+    void updateSize();
+
+  }; // end of class DigitalSetByBitGrid
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByBitGrid'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByBitGrid' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const DigitalSetByBitGrid<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByBitGrid.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByBitGrid_h
+
+#undef DigitalSetByBitGrid_RECURSES
+#endif // else defined(DigitalSetByBitGrid_RECURSES)
@@ -45,9 +45,12 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <boost/mpl/if.hpp>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+#include "DGtal/kernel/sets/DigitalSetByBitGrid.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -58,6 +61,31 @@ namespace DGtal
   enum DigitalSetVariability { LOW_VAR_DS = 0, HIGH_VAR_DS = 4 };
   enum DigitalSetIterability { LOW_ITER_DS = 0, HIGH_ITER_DS = 8 };
   enum DigitalSetBelongTestability { LOW_BEL_DS = 0, HIGH_BEL_DS = 16 };
+  enum DigitalSetStorage { DEFAULT_STORAGE_DS = 0, BIT_GRID_DS = 32 };
+
+  /**
+   * Tells if DigitalSetSelector chooses a DigitalSetByBitGrid for the
+   * given domain and preferences: never for other domains than
+   * HyperRectDomain.
+   */
+  template <typename Domain, int Preferences>
+  struct DigitalSetSelectorBitGrid
+  {
+    BOOST_STATIC_CONSTANT( bool, value = false );
+  };
+
+  /**
+   * For a HyperRectDomain, a bit grid is chosen only when it is asked
+   * for (BIT_GRID_DS), since it costs one bit per point of the domain
+   * whatever the size of the set, and visits the points in the order
+   * of the domain.
+   */
+  template <typename TSpace, int Preferences>
+  struct DigitalSetSelectorBitGrid< HyperRectDomain<TSpace>, Preferences >
+  {
+    BOOST_STATIC_CONSTANT
+    ( bool, value = ( Preferences & BIT_GRID_DS ) != 0 );
+  };
 
   /////////////////////////////////////////////////////////////////////////////
   // template class DigitalSetSelector
@@ -86,9 +114,14 @@ namespace DGtal
   {
     // ----------------------- Local types ------------------------------
     /**
-     * Adequate digital set representation for the given preferences.
+     * Adequate digital set representation for the given preferences:
+     * a DigitalSetByBitGrid in a HyperRectDomain when BIT_GRID_DS is
+     * given, a DigitalSetBySTLSet otherwise.
      */
-    typedef DigitalSetBySTLSet<Domain> Type;
+    typedef typename boost::mpl::if_c
+    < DigitalSetSelectorBitGrid<Domain, Preferences>::value,
+      DigitalSetByBitGrid<Domain>,
+      DigitalSetBySTLSet<Domain> >::type Type;
 
 
   }; // end of class DigitalSetSelector
@@ -0,0 +1,412 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ConnectedComponentLabelling.h
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module ConnectedComponentLabelling.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ConnectedComponentLabelling_RECURSES)
+#error Recursive header files inclusion detected in ConnectedComponentLabelling.h
+#else // defined(ConnectedComponentLabelling_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ConnectedComponentLabelling_RECURSES
+
+#if !defined ConnectedComponentLabelling_h
+/** Prevents repeated inclusion of headers. */
+#define ConnectedComponentLabelling_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/sets/DigitalSetByBitGrid.h"
+#include "DGtal/topology/Topology.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ConnectedComponentLabelling
+  /**
+   * Description of template class 'ConnectedComponentLabelling' <p>
+   * \brief Aim: Labels the connected components of a set of points
+   * of a HyperRectDomain, given by a predicate, with an image of
+   * labels over the domain.
+   *
+   * The components are computed with a union-find over the points of
+   * the domain, in the order of the domain (the first coordinate
+   * varies first), each point being merged with its adjacent points
+   * already visited. The domain is cut into slabs along its last
+   * coordinate, which are labelled independently (concurrently when
+   * DGtal is built WITH_OPENMP), then the slabs are merged pairwise
+   * along their common layers, again concurrently, in log2(nbSlabs)
+   * rounds. The components are finally numbered from 1 in the order
+   * of their first point, 0 being the label of the points outside the
+   * set.
+   *
+   * The adjacency must be invariant by translation and contained in
+   * the unit neighborhood of a point, like the MetricAdjacency of a
+   * DigitalTopology (4/8 in 2D, 6/18/26 in 3D). The domain must have
+   * less than 2^32-1 points.
+   *
+   *  @code
+   *  ConnectedComponentLabelling<Z3i::Domain> ccl( domain );
+   *  unsigned int nb = ccl.compute( Z3i::adj26, set );
+   *  std::vector<Z3i::DigitalSet> components;
+   *  std::back_insert_iterator< std::vector<Z3i::DigitalSet> > it( components );
+   *  ccl.writeSets<Z3i::DigitalSet>( it );
+   *  @endcode
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @see Object::writeComponents, testConnectedComponentLabelling.cpp
+   */
+  template <typename TDomain>
+  class ConnectedComponentLabelling
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TDomain Domain;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    typedef typename Space::Dimension Dimension;
+    /// The type of the labels, and of the indices of the points.
+    typedef DGtal::uint32_t Label;
+
+    /**
+     * Destructor.
+     */
+    ~ConnectedComponentLabelling();
+
+    /**
+     * Constructor. No component is computed.
+     *
+     * @param aDomain the domain of the labels.
+     * @throw InputException if the domain has too many points.
+     */
+    ConnectedComponentLabelling( const Domain & aDomain );
+
+    /**
+     * @param aDomain any domain.
+     * @return 'true' if the points of the domain can be labelled,
+     * i.e. it has less than 2^32-1 points.
+     */
+    static bool isLabellable( const Domain & aDomain );
+
+    /**
+     * Labels the connected components of the points of the domain
+     * satisfying a predicate.
+     *
+     * @tparam TAdjacency the type of an adjacency (e.g. MetricAdjacency).
+     * @tparam TPointPredicate the type of a predicate on points.
+     *
+     * @param anAdjacency the adjacency, invariant by translation.
+     * @param aPredicate the predicate defining the set.
+     * @param nbThreads the number of slabs labelled concurrently, 0
+     * for the number of threads given by OpenMP (1 without OpenMP).
+     *
+     * @return the number of components.
+     */
+    template <typename TAdjacency, typename TPointPredicate>
+    Label compute( const TAdjacency & anAdjacency,
+                   const TPointPredicate & aPredicate,
+                   unsigned int nbThreads = 0 );
+
+    /**
+     * Labels the connected components of a set of points. The bits of
+     * the set are read directly when it has the same domain.
+     *
+     * @tparam TAdjacency the type of an adjacency (e.g. MetricAdjacency).
+     *
+     * @param anAdjacency the adjacency, invariant by translation.
+     * @param aSet the set.
+     * @param nbThreads the number of slabs labelled concurrently, 0
+     * for the number of threads given by OpenMP (1 without OpenMP).
+     *
+     * @return the number of components.
+     */
+    template <typename TAdjacency>
+    Label compute( const TAdjacency & anAdjacency,
+                   const DigitalSetByBitGrid<Domain> & aSet,
+                   unsigned int nbThreads = 0 );
+
+    /**
+     * @return the domain of the labels.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the number of components of the last computation.
+     */
+    Label nbComponents() const;
+
+    /**
+     * @param p any point.
+     * @return the label of the component of [p], 0 if it is not in
+     * the set or not in the domain.
+     */
+    Label label( const Point & p ) const;
+
+    /**
+     * @return the labels of the points, in the order of the domain.
+     */
+    const std::vector<Label> & labels() const;
+
+    /**
+     * @param aLabel a label in 0..nbComponents().
+     * @return the number of points with this label.
+     */
+    Size size( Label aLabel ) const;
+
+    /**
+     * Writes the components, in the order of their labels, as digital
+     * sets on the output iterator [it]. A DigitalSetByBitGrid is built
+     * on the bounding box of its component, other sets on the domain
+     * of the labels.
+     *
+     * @tparam TDigitalSet a model of CDigitalSet, built from the domain.
+     * @tparam TOutputIterator an output iterator on TDigitalSet.
+     *
+     * @param it the output iterator.
+     */
+    template <typename TDigitalSet, typename TOutputIterator>
+    void writeSets( TOutputIterator & it ) const;
+
+    /**
+     * Writes the components, in the order of their labels, as
+     * connected objects on the output iterator [it]. Their sets are
+     * built as in writeSets().
+     *
+     * @tparam TObject an Object.
+     * @tparam TTopology the type of [aTopology], a
+     * TObject::DigitalTopology or a CowPtr on it.
+     * @tparam TOutputIterator an output iterator on TObject.
+     *
+     * @param aTopology the topology of the objects.
+     * @param it the output iterator.
+     */
+    template <typename TObject, typename TTopology, typename TOutputIterator>
+    void writeObjects( const TTopology & aTopology,
+                       TOutputIterator & it ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// A neighbor of a point visited before it.
+    struct Neighbor
+    {
+      /// The difference of the indices.
+      DGtal::int64_t shift;
+      /// The difference of the coordinates (-1, 0 or 1).
+      int step[ Space::dimension ];
+    };
+
+    /// The label of the points outside the set during the computation.
+    static const Label background = 0xFFFFFFFFu;
+
+    /// The domain of the labels.
+    Domain myDomain;
+    /// The lowest point of the domain.
+    Point myLower;
+    /// The number of points of the domain along each axis.
+    DGtal::uint64_t myExtent[ Space::dimension ];
+    /// The number of points of a layer (last coordinate constant).
+    DGtal::uint64_t myLayerSize;
+    /// The neighbors of a point visited before it.
+    std::vector<Neighbor> myNeighbors;
+    /// The parents of the union-find, then the labels.
+    std::vector<Label> myLabels;
+    /// The number of points of each label.
+    std::vector<Size> mySizes;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    ConnectedComponentLabelling();
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    ConnectedComponentLabelling ( const ConnectedComponentLabelling & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    ConnectedComponentLabelling & operator= ( const ConnectedComponentLabelling & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Computes myNeighbors from an adjacency.
+     * @param anAdjacency the adjacency.
+     */
+    template <typename TAdjacency>
+    void setNeighbors( const TAdjacency & anAdjacency );
+
+    /**
+     * @param nbThreads the number of threads asked (0 for OpenMP's).
+     * @return the number of slabs.
+     */
+    unsigned int nbSlabs( unsigned int nbThreads ) const;
+
+    /**
+     * @param slab a slab in 0..nb.
+     * @param nb the number of slabs.
+     * @return the first layer of [slab] (the number of layers if slab == nb).
+     */
+    DGtal::uint64_t firstLayer( unsigned int slab, unsigned int nb ) const;
+
+    /**
+     * Sets each point of the layers [first,last) to itself if it
+     * satisfies the predicate, to background otherwise.
+     */
+    template <typename TPointPredicate>
+    void initialize( DGtal::uint64_t first, DGtal::uint64_t last,
+                     const TPointPredicate & aPredicate );
+
+    /**
+     * Labels the slabs, merges them and numbers the components.
+     * @param nb the number of slabs.
+     * @return the number of components.
+     */
+    Label labelSlabs( unsigned int nb );
+
+    /**
+     * Merges each point of the layers [first,last) with its neighbors
+     * visited before it in the layers [lowest,last).
+     */
+    void mergeLayers( DGtal::uint64_t first, DGtal::uint64_t last,
+                      DGtal::uint64_t lowest );
+
+    /**
+     * Sorts the indices of the points of the set by label.
+     * @param first (returns) the points of label l are
+     * order[first[l-1]..first[l]).
+     * @param order (returns) the indices of the points of the set.
+     */
+    void sortByLabel( std::vector<DGtal::uint64_t> & first,
+                      std::vector<Label> & order ) const;
+
+    /**
+     * @param i the index of a point of the set.
+     * @return the root of its tree, the lowest index of the tree.
+     */
+    Label find( Label i );
+
+    /**
+     * Merges the trees of the points of indices [i] and [j].
+     */
+    void merge( Label i, Label j );
+
+    /**
+     * @param i the index of a point of the domain.
+     * @return the point.
+     */
+    Point point( DGtal::uint64_t i ) const;
+
+    /**
+     * @param first the points sorted by label (see sortByLabel).
+     * @param order the points sorted by label (see sortByLabel).
+     * @param aLabel a label in 1..nbComponents().
+     * @return the bounding box of the component of this label.
+     */
+    Domain boundingBox( const std::vector<DGtal::uint64_t> & first,
+                        const std::vector<Label> & order,
+                        Label aLabel ) const;
+
+    /**
+     * @return the domain of the set of a component: the domain of the
+     * labels for a set whose size does not depend on its domain.
+     */
+    template <typename TDigitalSet>
+    Domain componentDomain( const std::vector<DGtal::uint64_t> & first,
+                            const std::vector<Label> & order,
+                            Label aLabel, const TDigitalSet * ) const;
+
+    /**
+     * @return the domain of the set of a component: its bounding box
+     * for a grid of bits, which has one bit per point of its domain.
+     */
+    Domain componentDomain( const std::vector<DGtal::uint64_t> & first,
+                            const std::vector<Label> & order,
+                            Label aLabel, const DigitalSetByBitGrid<Domain> * ) const;
+
+  }; // end of class ConnectedComponentLabelling
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ConnectedComponentLabelling'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ConnectedComponentLabelling' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ConnectedComponentLabelling<TDomain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/ConnectedComponentLabelling.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ConnectedComponentLabelling_h
+
+#undef ConnectedComponentLabelling_RECURSES
+#endif // else defined(ConnectedComponentLabelling_RECURSES)
@@ -43,11 +43,13 @@
 #include <iostream>
 #include <string>
 #include <map>
+#include <boost/type_traits/is_same.hpp>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CowPtr.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
 #include "DGtal/topology/Topology.h"
+#include "DGtal/topology/ConnectedComponentLabelling.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -382,6 +384,14 @@ namespace DGtal
         
          @param it the output iterator. *it is an Object.
          @return the number of components.
+
+         When the set is a DigitalSetByBitGrid that fills at least
+         1/16 of its domain, the components are computed with a
+         ConnectedComponentLabelling of its domain (concurrently when
+         DGtal is built WITH_OPENMP), otherwise by breadth-first
+         traversals. They are written in the order of their first
+         point in both cases. The components of a DigitalSetByBitGrid
+         are grids of bits on their bounding boxes.
         
          NB: Be careful that the [it] should not be an output iterator
          pointing in the same container containing 'this'. The following
@@ -589,6 +599,69 @@ namespace DGtal
 
       // ------------------------- internals ------------------------------------
 
+      /// true_type when the set is a grid of bits, whose components
+      /// are computed with a ConnectedComponentLabelling.
+      typedef typename boost::is_same< DigitalSet,
+                                       DigitalSetByBitGrid<Domain> >::type
+      LabelledComponents;
+
+      /**
+         Computes the connected components of the object with a
+         ConnectedComponentLabelling of its domain.
+         @see writeComponents
+      */
+      template <typename OutputObjectIterator>
+      Size writeComponents( OutputObjectIterator & it,
+                            boost::true_type ) const;
+
+      /**
+         Computes the connected components of the object with
+         breadth-first traversals.
+         @see writeComponents
+      */
+      template <typename OutputObjectIterator>
+      Size writeComponents( OutputObjectIterator & it,
+                            boost::false_type ) const;
+
+      /**
+         Computes the connectedness of the object with a
+         ConnectedComponentLabelling of its domain.
+         @see computeConnectedness
+      */
+      Connectedness computeConnectedness( boost::true_type ) const;
+
+      /**
+         @return 'true' if the components are computed with a
+         ConnectedComponentLabelling: the domain can be labelled and
+         the set fills at least 1/16 of it, otherwise the labels would
+         take much more memory than the breadth-first traversals.
+      */
+      bool isLabellingWorthwhile() const;
+
+      /**
+         @param vertices the points of a component.
+         @return the domain of its set: the domain of the object.
+      */
+      template <typename TVertexSet>
+      Domain componentDomain( const TVertexSet & vertices,
+                              boost::false_type ) const;
+
+      /**
+         @param vertices the points of a component.
+         @return the domain of its set: its bounding box, since a grid
+         of bits takes one bit per point of its domain.
+      */
+      template <typename TVertexSet>
+      Domain componentDomain( const TVertexSet & vertices,
+                              boost::true_type ) const;
+
+      /**
+         Computes the connectedness of the object with a breadth-first
+         traversal.
+         @see computeConnectedness
+      */
+      Connectedness computeConnectedness( boost::false_type ) const;
+
   }; // end of class Object
 
 
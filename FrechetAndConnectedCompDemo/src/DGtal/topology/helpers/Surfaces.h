@@ -556,6 +556,12 @@ namespace DGtal
        signed surfels whose elements represents a boundary component of
        a digital shape defined by the predicate [pp]. The algorithms
        tracks surfels along the boundary of the shape.
+
+       The boundary surfels are found with a raster scan of the bounds
+       of [aKSpace] and the tracked ones are marked in a bit grid, so
+       that the extraction is linear in the size of the space. The
+       contours are given in the order of their first surfel in a
+       std::set<SCell> of the boundary (see sMakeBoundary).
        
        @tparam PointPredicate a model of CPointPredicate describing
        the inside of a digital shape, meaning a functor taking a Point
@@ -581,12 +587,88 @@ namespace DGtal
       const PointPredicate & pp );
     
 
+    /**
+       Extracts the contours of a family of nested 2D shapes, as
+       extractAll2DSCellContours would for each of them, with a single
+       scan of the space. The shape of level i is the set of points p
+       such that lf(p) <= i: a point entering the shape at some level
+       stays inside at the following ones (e.g. the shapes obtained by
+       thresholding an image with an increasing upper bound).
+
+       Each surfel is computed once, with the range of levels on whose
+       boundary it lies, so that the boundary of each level is obtained
+       from the one of the previous level in time linear in their
+       sizes. The contours of the different levels are then tracked
+       independently, in parallel when DGtal is built WITH_OPENMP.
+
+       @tparam LevelFunctor a functor taking a Point and returning the
+       first level (an unsigned int) whose shape contains it, or any
+       value not smaller than [nbLevels] if there is none.
+
+       @param aVectLevelContours (modified) for each level i, the
+       contours given by extractAll2DSCellContours for the shape of
+       level i, in the same order.
+
+       @param aKSpace any space.
+
+       @param aSurfelAdj the surfel adjacency chosen for the tracking.
+
+       @param lf the level functor.
+
+       @param nbLevels the number of levels.
+    */
+    template <typename LevelFunctor>
+    static
+    void extractAll2DSCellContoursByLevels
+    ( std::vector< std::vector< std::vector<SCell> > > & aVectLevelContours,
+      const KSpace & aKSpace,
+      const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
+      const LevelFunctor & lf,
+      unsigned int nbLevels );
+
+    /**
+       Extracts the 4-connected contours of a family of nested 2D
+       shapes as sequences of points, as extractAllPointContours4C
+       would for each of them. See extractAll2DSCellContoursByLevels.
+
+       @tparam LevelFunctor a functor taking a Point and returning the
+       first level whose shape contains it.
+
+       @param aVectLevelContours (modified) for each level, its
+       contours represented by vectors of points.
+
+       @param aKSpace any space.
+
+       @param lf the level functor.
+
+       @param nbLevels the number of levels.
+
+       @param aSAdj the surfel adjacency chosen for the tracking.
+    */
+    template <typename LevelFunctor>
+    static
+    void extractAllPointContours4CByLevels
+    ( std::vector< std::vector< std::vector< Point > > > & aVectLevelContours,
+      const KSpace & aKSpace,
+      const LevelFunctor & lf,
+      unsigned int nbLevels,
+      const SurfelAdjacency<2> & aSAdj );
+
     /**
        Extract all surfel elements associated to each connected
        components of the given DigitalSet. The connected surfel set
        are given as result in a vector containing all components. The
        orientation of the resulting SCell indicates the exterior
        orientation according the positive axis.
+
+       The components are given in the order of their lowest surfel,
+       each one sorted, as the successive trackBoundary of the lowest
+       remaining boundary surfel would give them. The boundary
+       surfels are stored in a bit grid over the Khalimsky
+       coordinates of the space and grouped by a union-find on their
+       adjacencies, computed by slabs of the space (concurrently when
+       DGtal is built WITH_OPENMP), so that the result does not
+       depend on the number of threads.
        
        @tparam PointPredicate a model of CPointPredicate describing
        the inside of a digital shape, meaning a functor taking a Point
@@ -617,6 +699,29 @@ namespace DGtal
       const PointPredicate & pp,
       bool forceOrientCellExterior=false );
 
+    /**
+       Same as above, but each connected component is written to an
+       output iterator as soon as it is tracked, so that it can be
+       processed (e.g. exported) without keeping all the components.
+
+       @tparam PointPredicate a model of CPointPredicate.
+       @tparam OutputIterator a model of output iterator on std::vector<SCell>.
+
+       @param outIt the output iterator receiving each component.
+       @param aKSpace any space.
+       @param aSurfelAdj the surfel adjacency chosen for the tracking.
+       @param pp an instance of a model of CPointPredicate.
+       @param forceOrientCellExterior see above.
+       @return the output iterator after the last component.
+    */
+    template <typename PointPredicate, typename OutputIterator>
+    static 
+    OutputIterator extractAllConnectedSCell
+    ( OutputIterator outIt,
+      const KSpace & aKSpace,
+      const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
+      const PointPredicate & pp,
+      bool forceOrientCellExterior=false );
     
     
 
@@ -834,6 +939,128 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       The shape of level [level] of a level functor, as a model of
+       CPointPredicate.
+    */
+    template <typename LevelFunctor>
+    struct LevelPredicate
+    {
+      typedef typename KSpace::Point Point;
+      LevelPredicate( const LevelFunctor & lf, unsigned int level )
+        : myLevelFunctor( &lf ), myLevel( level )
+      {}
+      bool operator()( const Point & p ) const
+      {
+        return (*myLevelFunctor)( p ) <= myLevel;
+      }
+      const LevelFunctor* myLevelFunctor;
+      unsigned int myLevel;
+    };
+
+    /**
+       The boundary surfels (bels) of a shape, as a bit grid over the
+       Khalimsky coordinates of the space, the first coordinate
+       varying last: the bels are numbered in the order of their
+       coordinates, their numbers (positions) being the ranks of
+       their bits.
+    */
+    struct BelGrid
+    {
+      /// The Khalimsky coordinates of the lowest pointel of the space.
+      Point klow;
+      /// The strides of the grid along each axis.
+      DGtal::uint64_t stride[ KSpace::dimension ];
+      /// The number of cells of the grid.
+      DGtal::uint64_t nbCells;
+      /// One bit per cell, set for the bels.
+      std::vector<DGtal::uint64_t> bits;
+      /// One bit per cell, set for the positive bels.
+      std::vector<DGtal::uint64_t> signs;
+      /// The number of bels before each word of bits.
+      std::vector<DGtal::uint32_t> rank;
+      /// The index in the grid of each bel.
+      std::vector<DGtal::uint64_t> cells;
+
+      /// @return the index in the grid of the cell [c].
+      DGtal::uint64_t index( const KSpace & K, const SCell & c ) const
+      {
+        Point kp = K.sKCoords( c ) - klow;
+        DGtal::uint64_t i = 0;
+        for ( DGtal::Dimension k = 0; k < KSpace::dimension; ++k )
+          i += (DGtal::uint64_t) kp[ k ] * stride[ k ];
+        return i;
+      }
+      /// @return the number of bels of index lower than [i].
+      DGtal::uint32_t position( DGtal::uint64_t i ) const;
+      /// @return the bel at position [pos].
+      SCell cell( const KSpace & K, DGtal::uint32_t pos ) const;
+      /// @return 'true' if the bel at position [pos] is positive.
+      bool positive( DGtal::uint32_t pos ) const
+      {
+        return ( signs[ cells[ pos ] >> 6 ] >> ( cells[ pos ] & 63 ) ) & 1;
+      }
+    };
+
+    /**
+       Merges the trees of the bels whose first Khalimsky coordinate
+       (relative to the space) is in [first,last) with the trees of
+       their adjacent bels whose first coordinate is in [low,high).
+
+       @param parent the union-find of the bels, the root of a tree
+       being its lowest position.
+    */
+    template <typename PointPredicate>
+    static
+    void mergeAdjacentBels( std::vector<DGtal::uint32_t> & parent,
+                            const BelGrid & bels,
+                            const KSpace & aKSpace,
+                            const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
+                            const PointPredicate & pp,
+                            DGtal::uint64_t first, DGtal::uint64_t last,
+                            DGtal::uint64_t low, DGtal::uint64_t high );
+
+    /**
+       Tracks the contours of a 2D shape from its boundary surfels.
+
+       @param aVectSCellContour2D (modified) the contours, in the
+       order of their first surfel in [bdry].
+
+       @param aKSpace any space.
+
+       @param aSurfelAdj the surfel adjacency chosen for the tracking.
+
+       @param pp the shape.
+
+       @param bdry the negative then the positive boundary surfels,
+       sorted.
+
+       @param visited a bit grid over the Khalimsky coordinates of the
+       space, all false. It is left all false.
+    */
+    template <typename PointPredicate>
+    static
+    void track2DContours( std::vector< std::vector<SCell> > & aVectSCellContour2D,
+                          const KSpace & aKSpace,
+                          const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
+                          const PointPredicate & pp,
+                          const std::vector<SCell> bdry[ 2 ],
+                          std::vector<bool> & visited );
+
+    /**
+       Converts 2D contours of surfels into contours of points, as
+       extractAllPointContours4C.
+
+       @param aVectPointContour2D (modified) the contours of points.
+       @param aKSpace any space.
+       @param vectContoursBdrySCell the contours of surfels.
+    */
+    static
+    void sCellContoursToPointContours4C
+    ( std::vector< std::vector< Point > > & aVectPointContour2D,
+      const KSpace & aKSpace,
+      const std::vector< std::vector<SCell> > & vectContoursBdrySCell );
+
   }; // end of class Surfaces
 
 
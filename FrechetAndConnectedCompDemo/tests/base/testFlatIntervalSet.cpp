@@ -0,0 +1,129 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFlatIntervalSet.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class FlatIntervalSet against boost::icl::interval_set.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <boost/icl/interval_set.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/FlatIntervalSet.h"
+
+using namespace DGtal;
+
+typedef FlatIntervalSet<double> MyIntervalSet;
+typedef boost::icl::interval_set<double> ICLIntervalSet;
+
+bool
+isEqual( const MyIntervalSet & s1, const ICLIntervalSet & s2 )
+{
+  if ( s1.size() != boost::icl::interval_count( s2 ) )
+    return false;
+  MyIntervalSet::ConstIterator it1 = s1.begin();
+  for ( ICLIntervalSet::const_iterator it2 = s2.begin();
+        it2 != s2.end(); ++it2, ++it1 )
+    if ( ( it1->first != boost::icl::lower( *it2 ) )
+         || ( it1->second != boost::icl::upper( *it2 ) ) )
+      return false;
+  return s1.isValid();
+}
+
+void insert( MyIntervalSet & s1, ICLIntervalSet & s2, double a, double b )
+{
+  s1.insert( a, b );
+  s2.insert( boost::icl::interval<double>::closed( a, b ) );
+}
+
+bool
+checkContains( const MyIntervalSet & s1, const ICLIntervalSet & s2,
+               unsigned int nb )
+{
+  for ( unsigned int i = 0; i < nb; ++i )
+    {
+      double x = ( random() % 1000 ) / 10.0;
+      if ( s1.contains( x ) != boost::icl::contains( s2, x ) )
+        return false;
+      if ( s1.contains( x ) != ( s1.find( x ) != s1.end() ) )
+        return false;
+    }
+  return true;
+}
+
+int main()
+{
+  unsigned int nb = 0;
+  unsigned int nbok = 0;
+  trace.beginBlock ( "Testing FlatIntervalSet" );
+  MyIntervalSet s;
+  ICLIntervalSet v;
+  ++nb, nbok += isEqual( s, v ) ? 1 : 0;
+  std::cout << "(" << nbok << "/" << nb << ") s=" << s << std::endl;
+  insert( s, v, 2.0, 3.0 );
+  insert( s, v, 5.0, 8.0 );
+  insert( s, v, 0.0, 1.0 );
+  ++nb, nbok += isEqual( s, v ) ? 1 : 0;
+  std::cout << "(" << nbok << "/" << nb << ") s=" << s << std::endl;
+  // touching closed intervals are merged, empty ones are ignored
+  insert( s, v, 1.0, 1.5 );
+  insert( s, v, 4.0, 3.5 );
+  ++nb, nbok += isEqual( s, v ) ? 1 : 0;
+  std::cout << "(" << nbok << "/" << nb << ") s=" << s << std::endl;
+  // an interval covering several ones
+  insert( s, v, 1.2, 6.0 );
+  ++nb, nbok += isEqual( s, v ) ? 1 : 0;
+  std::cout << "(" << nbok << "/" << nb << ") s=" << s << std::endl;
+  ++nb, nbok += ( s.contains( 0.0 ) && s.contains( 8.0 )
+                  && ! s.contains( 8.5 ) ) ? 1 : 0;
+  std::cout << "(" << nbok << "/" << nb << ") contains" << std::endl;
+  // equal_range and erase allow to undo an insertion
+  MyIntervalSet save( s );
+  MyIntervalSet::Interval i( 8.0, 9.0 );
+  std::pair<MyIntervalSet::ConstIterator,MyIntervalSet::ConstIterator> r
+    = s.equal_range( i );
+  std::vector<MyIntervalSet::Interval> absorbed( r.first, r.second );
+  s.erase( s.insert( i ) );
+  for ( unsigned int k = 0; k < absorbed.size(); ++k )
+    s.insert( absorbed[ k ] );
+  ++nb, nbok += ( s.size() == save.size()
+                  && std::equal( s.begin(), s.end(), save.begin() ) ) ? 1 : 0;
+  std::cout << "(" << nbok << "/" << nb << ") undo s=" << s << std::endl;
+  for ( unsigned int k = 0; k < 200; ++k )
+    {
+      double a = ( random() % 1000 ) / 10.0;
+      double b = a + ( random() % 50 ) / 10.0;
+      insert( s, v, a, b );
+    }
+  ++nb, nbok += isEqual( s, v ) ? 1 : 0;
+  std::cout << "(" << nbok << "/" << nb << ") random insertions" << std::endl;
+  ++nb, nbok += checkContains( s, v, 1000 ) ? 1 : 0;
+  std::cout << "(" << nbok << "/" << nb << ") random contains" << std::endl;
+  s.clear();
+  v.clear();
+  ++nb, nbok += isEqual( s, v ) ? 1 : 0;
+  std::cout << "(" << nbok << "/" << nb << ") clear" << std::endl;
+  trace.endBlock();
+  return ( nb == nbok ) ? 0 : 1;
+}
+/** @ingroup Tests **/
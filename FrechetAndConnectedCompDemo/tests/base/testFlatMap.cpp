@@ -0,0 +1,104 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFlatMap.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class FlatMap against std::map.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/FlatMap.h"
+
+using namespace DGtal;
+
+typedef FlatMap<int,double> MyMap;
+typedef std::map<int,double> STLMap;
+
+bool
+isEqual( const MyMap & m1, const STLMap & m2 )
+{
+  if ( m1.size() != m2.size() )
+    return false;
+  MyMap::ConstIterator it1 = m1.begin();
+  for ( STLMap::const_iterator it2 = m2.begin(); it2 != m2.end(); ++it2, ++it1 )
+    if ( ( it1->first != it2->first ) || ( it1->second != it2->second ) )
+      return false;
+  return m1.isValid();
+}
+
+int main()
+{
+  unsigned int nb = 0;
+  unsigned int nbok = 0;
+  trace.beginBlock ( "Testing FlatMap" );
+  MyMap m;
+  STLMap v;
+  ++nb, nbok += isEqual( m, v ) ? 1 : 0;
+  std::cout << "(" << nbok << "/" << nb << ") m=" << m << std::endl;
+  // increasing insertions at the end
+  for ( int k = 0; k < 10; ++k )
+    {
+      m.insert( m.end(), std::make_pair( 2*k, (double) k ) );
+      v.insert( v.end(), std::make_pair( 2*k, (double) k ) );
+    }
+  ++nb, nbok += isEqual( m, v ) ? 1 : 0;
+  std::cout << "(" << nbok << "/" << nb << ") m=" << m << std::endl;
+  // wrong hint, existing key
+  m.insert( m.end(), std::make_pair( 3, 0.5 ) );
+  v.insert( v.end(), std::make_pair( 3, 0.5 ) );
+  ++nb, nbok += ( ! m.insert( std::make_pair( 4, 7.0 ) ).second ) ? 1 : 0;
+  ++nb, nbok += isEqual( m, v ) ? 1 : 0;
+  std::cout << "(" << nbok << "/" << nb << ") m=" << m << std::endl;
+  // erasure while iterating
+  for ( MyMap::Iterator it = m.begin(); it != m.end(); )
+    if ( it->first % 3 == 0 ) it = m.erase( it );
+    else ++it;
+  for ( STLMap::iterator it = v.begin(); it != v.end(); )
+    if ( it->first % 3 == 0 ) v.erase( it++ );
+    else ++it;
+  ++nb, nbok += isEqual( m, v ) ? 1 : 0;
+  std::cout << "(" << nbok << "/" << nb << ") m=" << m << std::endl;
+  for ( unsigned int k = 0; k < 500; ++k )
+    {
+      int key = random() % 100;
+      if ( random() % 3 == 0 )
+        {
+          ++nb, nbok += ( m.erase( key ) == v.erase( key ) ) ? 1 : 0;
+        }
+      else
+        {
+          m[ key ] += 1.0;
+          v[ key ] += 1.0;
+        }
+    }
+  ++nb, nbok += isEqual( m, v ) ? 1 : 0;
+  std::cout << "(" << nbok << "/" << nb << ") random operations" << std::endl;
+  ++nb, nbok += ( ( m.find( 1000 ) == m.end() )
+                  && ( m.find( m.begin()->first ) == m.begin() ) ) ? 1 : 0;
+  std::cout << "(" << nbok << "/" << nb << ") find" << std::endl;
+  trace.endBlock();
+  return ( nb == nbok ) ? 0 : 1;
+}
+/** @ingroup Tests **/
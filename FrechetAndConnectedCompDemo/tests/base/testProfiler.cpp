@@ -0,0 +1,250 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testProfiler.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class Profiler.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Profiler.h"
+#include "DGtal/base/ProfilerAllocations.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class Profiler.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return the number of occurrences of a string in another one.
+ */
+unsigned int occurrences( const std::string & s, const std::string & pattern )
+{
+  unsigned int n = 0;
+  for ( std::string::size_type pos = s.find( pattern ); pos != std::string::npos;
+        pos = s.find( pattern, pos + 1 ) )
+    ++n;
+  return n;
+}
+
+/**
+ * @return the statistics of the zones of a given name (count is 0
+ * if there is none).
+ */
+Profiler::ZoneStatistics find( const Profiler & p, const std::string & name )
+{
+  std::vector<Profiler::ZoneStatistics> stats = p.statistics();
+  for ( unsigned int i = 0; i < stats.size(); ++i )
+    if ( stats[ i ].name == name ) return stats[ i ];
+  Profiler::ZoneStatistics none = Profiler::ZoneStatistics();
+  none.count = 0;
+  return none;
+}
+
+double work( unsigned int n )
+{
+  double s = 0.0;
+  for ( unsigned int i = 1; i <= n; ++i )
+    s += 1.0 / i;
+  return s;
+}
+
+/**
+ * Nested zones, from ProfileZone and from the blocks of trace.
+ */
+bool testZones()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing nested zones ..." );
+  double s = 0.0;
+  profiler.disable();
+  profiler.clear();
+  {
+    ProfileZone zone( "ignored" );
+    s += work( 1000 );
+  }
+  nbok += ( profiler.size() == 0 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "nothing recorded when disabled" << std::endl;
+
+  profiler.enable();
+  trace.beginBlock( "outer" );
+  for ( unsigned int i = 0; i < 10; ++i )
+    {
+      ProfileZone zone( "inner" );
+      s += work( 1000 * ( i + 1 ) );
+    }
+  {
+    ProfileZone zone( "closed early" );
+    s += work( 1000 );
+    double duration = zone.end();
+    nbok += ( duration >= 0.0 ) ? 1 : 0; nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") "
+                 << "end() returns the duration " << duration << std::endl;
+  }
+  trace.endBlock();
+  trace.info() << profiler << " " << s << std::endl;
+
+  Profiler::ZoneStatistics outer = find( profiler, "outer" );
+  Profiler::ZoneStatistics inner = find( profiler, "inner" );
+  nbok += ( profiler.size() == 12 && outer.count == 1 && inner.count == 10
+            && find( profiler, "closed early" ).count == 1 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "one zone per block, per scope and per end()" << std::endl;
+  nbok += ( inner.min <= inner.p50 && inner.p50 <= inner.p90 && inner.p90 <= inner.p99
+            && inner.p99 <= inner.max && inner.total <= outer.total
+            && inner.mean * 10 <= inner.total * 1.0001 && inner.total <= inner.mean * 10 * 1.0001 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "inner: total=" << inner.total << " min=" << inner.min
+               << " p50=" << inner.p50 << " p90=" << inner.p90 << " max=" << inner.max << std::endl;
+  nbok += ( profiler.statistics().front().name == "outer" ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "sorted by decreasing total time" << std::endl;
+
+  trace.endBlock();
+  profiler.disable();
+  return nbok == nb;
+}
+
+/**
+ * Zones opened by several threads.
+ */
+bool testThreads()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing zones in threads ..." );
+  profiler.enable();
+  const int n = 64;
+  std::vector<double> results( n );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(4)
+#endif
+  for ( int i = 0; i < n; ++i )
+    {
+      ProfileZone zone( "task" );
+      ProfileZone subZone( "subtask" );
+      results[ i ] = work( 10000 );
+    }
+  profiler.disable();
+  nbok += ( find( profiler, "task" ).count == (unsigned long) n
+            && find( profiler, "subtask" ).count == (unsigned long) n ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "all the zones of all the threads" << std::endl;
+
+  std::ostringstream json;
+  profiler.writeChromeTrace( json );
+  std::string s = json.str();
+  nbok += ( s.compare( 0, 15, "{\"traceEvents\":" ) == 0
+            && occurrences( s, "\"ph\":\"X\"" ) == 2 * n
+            && occurrences( s, "\"name\":\"subtask\"" ) == (unsigned int) n
+            && occurrences( s, "\"depth\":1" ) == (unsigned int) n ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "Chrome trace with " << occurrences( s, "\"ph\":\"X\"" ) << " events" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/// Escapes the allocations, which the compiler could elide otherwise.
+int * allocated[ 3 ];
+
+/**
+ * Allocation counters, and the CSV report.
+ */
+bool testAllocations()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing allocation counters ..." );
+  profiler.enable();
+  profiler.countAllocations( true );
+  {
+    ProfileZone zone( "allocations, \"quoted\"" );
+    for ( unsigned int i = 0; i < 3; ++i )
+      {
+        ProfileZone inner( "allocation" );
+        allocated[ i ] = new int[ 10 ];
+      }
+  }
+  for ( unsigned int i = 0; i < 3; ++i )
+    delete[] allocated[ i ];
+  profiler.countAllocations( false );
+  profiler.disable();
+  Profiler::ZoneStatistics outer = find( profiler, "allocations, \"quoted\"" );
+  Profiler::ZoneStatistics inner = find( profiler, "allocation" );
+  nbok += ( inner.count == 3 && inner.allocations == 3
+            && inner.allocatedBytes == 30 * sizeof( int )
+            && outer.allocations == 3 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << inner.allocations << " allocations of " << inner.allocatedBytes
+               << " bytes, the profiler's own are not counted" << std::endl;
+
+  std::ostringstream csv;
+  profiler.writeCSV( csv );
+  std::string s = csv.str();
+  nbok += ( s.compare( 0, 11, "name,count," ) == 0 && occurrences( s, "\n" ) == 3
+            && s.find( "\"allocations, \"\"quoted\"\"\",1," ) != std::string::npos ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "CSV report" << std::endl << s;
+
+  nbok += ( profiler.write( "testProfiler.json" ) ) ? 1 : 0; nb++;
+  std::ifstream file( "testProfiler.json" );
+  std::string line;
+  std::getline( file, line );
+  nbok += ( line == "{\"traceEvents\":[" ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "Chrome trace written in testProfiler.json" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class Profiler" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testZones() && testThreads() && testAllocations(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
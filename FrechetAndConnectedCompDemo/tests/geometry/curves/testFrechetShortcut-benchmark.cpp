@@ -0,0 +1,169 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFrechetShortcut-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Benchmark of FrechetShortcut::isExtendableForward: journaled
+ * speculative update of the backpaths versus the copy of the eight
+ * backpaths.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/curves/FrechetShortcut.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef PointVector<2,int> Point;
+typedef std::vector<Point>::const_iterator ConstIterator;
+
+/**
+ * FrechetShortcut tested the way it was before the undo journal:
+ * the eight backpaths are saved, updated and copied back.
+ */
+class CopyFrechetShortcut : public FrechetShortcut<ConstIterator,int>
+{
+public:
+  typedef FrechetShortcut<ConstIterator,int> Super;
+
+  CopyFrechetShortcut(double error) : Super(error) {}
+
+  bool isExtendableForwardByCopy()
+  {
+    if(!testUpdateWidth())
+      return false;
+
+    std::vector<Backpath> backpathSave;
+    for(unsigned int i=0;i<8;i++)
+      backpathSave.push_back(Backpath(myBackpath[i]));
+
+    bool flag = updateBackpath();
+
+    for(unsigned int i=0;i<8;i++)
+      myBackpath[i] = Backpath(backpathSave[i]);
+
+    return flag;
+  }
+};
+
+/**
+ * Builds a closed noisy 8-connected contour of about 2*pi*radius*1.4 points.
+ */
+std::vector<Point> noisyContour(int radius, unsigned int seed)
+{
+  srand(seed);
+  std::vector<Point> contour;
+  Point prev(radius,0);
+  contour.push_back(prev);
+  int n = (int) (8*radius);
+  for(int i=1;i<=n;i++)
+    {
+      double t = 2*M_PI*i/n;
+      double r = radius + 0.1*radius*sin(7*t) + (rand()%5) - 2;
+      Point p((int) floor(r*cos(t)+0.5), (int) floor(r*sin(t)+0.5));
+      // walk to p with elementary 8-connected steps
+      while(p != prev)
+	{
+	  Point step((p[0]>prev[0]) - (p[0]<prev[0]),
+		     (p[1]>prev[1]) - (p[1]<prev[1]));
+	  prev += step;
+	  contour.push_back(prev);
+	}
+    }
+  return contour;
+}
+
+/**
+ * Runs the greedy segmentation driven by isExtendableForward.
+ * @return the number of segments; ok is false if a test disagrees
+ * with the actual extension.
+ */
+unsigned int greedy(const std::vector<Point> & contour, double error,
+		    bool byCopy, bool & ok)
+{
+  CopyFrechetShortcut s(error);
+  s.init(contour.begin());
+  unsigned int nbSegments = 1;
+  while(s.end() != contour.end())
+    {
+      bool test = byCopy ? s.isExtendableForwardByCopy() : s.isExtendableForward();
+      if(test)
+	ok = s.extendForward() && ok;
+      else
+	{
+	  ConstIterator last = s.end();
+	  --last;
+	  s.init(last);
+	  nbSegments++;
+	}
+    }
+  return nbSegments;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmark of FrechetShortcut::isExtendableForward" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = true;
+  int radius = 10000;
+  std::vector<Point> contour = noisyContour(radius, 42);
+  trace.info() << "contour size = " << contour.size() << endl;
+
+  std::cout << "# error copy(ms) journal(ms) nbSegments" << std::endl;
+  double errors[] = { 2, 5, 10 };
+  for(unsigned int i=0;i<3;i++)
+    {
+      bool ok = true;
+      Clock c;
+      c.startClock();
+      unsigned int n1 = greedy(contour, errors[i], true, ok);
+      double tCopy = c.stopClock();
+      c.startClock();
+      unsigned int n2 = greedy(contour, errors[i], false, ok);
+      double tJournal = c.stopClock();
+      std::cout << errors[i] << " " << tCopy << " " << tJournal << " "
+		<< n2 << std::endl;
+      res = res && ok && (n1 == n2);
+    }
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
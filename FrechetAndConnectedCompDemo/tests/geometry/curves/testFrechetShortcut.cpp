@@ -37,6 +37,7 @@
 
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Exceptions.h"
+#include "DGtal/base/Circulator.h"
 #include "DGtal/kernel/SpaceND.h"
 
 #include "DGtal/kernel/domains/HyperRectDomain.h"
@@ -116,6 +117,295 @@ bool testFrechetShortcut()
 
 
 
+/**
+ * isExtendableForward() must predict extendForward() without
+ * modifying the shortcut.
+ */
+bool testIsExtendableForward()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef PointVector<2,int> Point;
+  typedef std::vector<Point>::const_iterator ConstIterator;
+  typedef FrechetShortcut<ConstIterator,int> Shortcut;
+
+  // a curve with several backpaths
+  std::vector<Point> contour;
+  int x = 0;
+  int y = 0;
+  contour.push_back(Point(x,y));
+  for(int k=0;k<4;k++)
+    {
+      for(int i=0;i<6;i++)
+	contour.push_back(Point(++x,y));
+      contour.push_back(Point(x,++y));
+      for(int i=0;i<4;i++)
+	contour.push_back(Point(--x,y));
+      contour.push_back(Point(x,++y));
+    }
+
+  trace.beginBlock ( "Testing isExtendableForward ..." );
+
+  double errors[] = { 1, 2, 3 };
+  for(unsigned int e=0;e<3;e++)
+    {
+      Shortcut s(errors[e]);
+      s.init(contour.begin());
+      while(s.end() != contour.end())
+	{
+	  // testing twice must give the same answer
+	  bool test = s.isExtendableForward();
+	  bool test2 = s.isExtendableForward();
+	  bool flag = s.extendForward();
+	  nbok += ((test == flag) && (test2 == flag)) ? 1 : 0;
+	  nb++;
+	  if(!flag)
+	    {
+	      ConstIterator last = s.end();
+	      --last;
+	      s.init(last);
+	    }
+	}
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") predictions" << std::endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * The backpaths of a copied or assigned shortcut must belong to the
+ * copy, not to the original, which may be reused or destroyed. An
+ * assigned shortcut extends as the original would, a copy as the copy
+ * of an untouched twin of the original (the copy constructor resets
+ * the backpaths and the cone).
+ */
+bool testCopy()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef PointVector<2,int> Point;
+  typedef std::vector<Point>::const_iterator ConstIterator;
+  typedef FrechetShortcut<ConstIterator,int> Shortcut;
+
+  // a curve with several backpaths
+  std::vector<Point> contour;
+  int x = 0;
+  int y = 0;
+  contour.push_back(Point(x,y));
+  for(int k=0;k<4;k++)
+    {
+      for(int i=0;i<6;i++)
+	contour.push_back(Point(++x,y));
+      contour.push_back(Point(x,++y));
+      for(int i=0;i<4;i++)
+	contour.push_back(Point(--x,y));
+      contour.push_back(Point(x,++y));
+    }
+
+  trace.beginBlock ( "Testing copy and assignment ..." );
+
+  double errors[] = { 1, 2, 3 };
+  for(unsigned int e=0;e<3;e++)
+    for(unsigned int m=1;m<contour.size();m++)
+      {
+	Shortcut s(errors[e]);
+	Shortcut twin(errors[e]);
+	s.init(contour.begin());
+	twin.init(contour.begin());
+	bool flag = true;
+	for(unsigned int i=1;i<m && flag;i++)
+	  flag = s.extendForward() && twin.extendForward();
+	if(!flag)
+	  break;
+	Shortcut copy(s);
+	Shortcut twinCopy(twin);
+	Shortcut assigned(errors[e]);
+	assigned = s;
+	// the original is reused, with another error
+	s = Shortcut(errors[(e+2)%3]);
+	s.init(contour.end()-1);
+	while(flag && twin.end() != contour.end())
+	  {
+	    flag = twin.extendForward();
+	    nbok += (assigned.extendForward() == flag) ? 1 : 0;
+	    nb++;
+	  }
+	flag = true;
+	while(flag && twinCopy.end() != contour.end())
+	  {
+	    flag = twinCopy.extendForward();
+	    nbok += (copy.extendForward() == flag) ? 1 : 0;
+	    nb++;
+	  }
+      }
+  trace.info() << "(" << nbok << "/" << nb << ") extensions" << std::endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * A shortcut on a circulator must behave as on the unrolled closed
+ * curve, including when it goes round the end of the range.
+ */
+bool testCirculator()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef PointVector<2,int> Point;
+  typedef std::vector<Point>::const_iterator ConstIterator;
+  typedef Circulator<ConstIterator> ConstCirculator;
+  typedef FrechetShortcut<ConstIterator,int> Shortcut;
+  typedef FrechetShortcut<ConstCirculator,int> CirculatorShortcut;
+
+  // a noisy closed 4-connected curve, given by its Freeman chain code
+  const std::string code = "11212222212110101012212212223212122122333232221232222232332330303330303033033323003033303000100010101000100000001112121210000101";
+  const Point moves[4] = { Point(1,0), Point(0,1), Point(-1,0), Point(0,-1) };
+  std::vector<Point> contour;
+  Point p(0,0);
+  for(unsigned int i=0;i<code.size();i++)
+    {
+      contour.push_back(p);
+      p += moves[code[i]-'0'];
+    }
+  // the curve unrolled twice
+  std::vector<Point> unrolled(contour);
+  unrolled.insert(unrolled.end(), contour.begin(), contour.end());
+
+  trace.beginBlock ( "Testing the shortcut on a circulator ..." );
+
+  double errors[] = { 1, 2, 3 };
+  int n = (int) contour.size();
+  for(unsigned int e=0;e<3;e++)
+    for(int k=0;k<n;k++)
+      {
+	Shortcut s(errors[e]);
+	s.init(unrolled.begin()+k);
+	CirculatorShortcut c(errors[e]);
+	c.init(ConstCirculator(contour.begin()+k, contour.begin(), contour.end()));
+	bool flag = true;
+	for(int i=1;i<n && flag;i++)
+	  {
+	    flag = s.extendForward();
+	    bool ok = (c.extendForward() == flag);
+	    nbok += ok ? 1 : 0;
+	    nb++;
+	  }
+      }
+  trace.info() << "(" << nbok << "/" << nb << ") extensions" << std::endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * With the FrechetExactCone policy, the width test is the one of its
+ * definition, and the shortcuts are the ones of the default policy.
+ */
+bool testExactCone()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef PointVector<2,int> Point;
+  typedef std::vector<Point>::const_iterator ConstIterator;
+  typedef FrechetShortcut<ConstIterator,int> Shortcut;
+  typedef FrechetShortcut<ConstIterator,int,FrechetExactCone> ExactShortcut;
+
+  // a noisy 4-connected curve, given by its Freeman chain code
+  const std::string code = "11212222212110101012212212223212122122333232221232222232332330303330303033033323003033303000100010101000100000001112121210000101";
+  const Point moves[4] = { Point(1,0), Point(0,1), Point(-1,0), Point(0,-1) };
+  std::vector<Point> contour;
+  Point p(0,0);
+  contour.push_back(p);
+  for(unsigned int i=0;i<code.size();i++)
+    {
+      p += moves[code[i]-'0'];
+      contour.push_back(p);
+    }
+
+  trace.beginBlock ( "Testing the exact cone ..." );
+
+  // the width test: for each point q between the first point and the
+  // new one, such that 2|q|^2 >= e^2, the new direction d satisfies
+  // d.q >= 0 and 2 (d x q)^2 <= e^2 |d|^2
+  int errors[] = { 1, 2, 3, 5 };
+  for(unsigned int e=0;e<4;e++)
+    {
+      ExactShortcut s(errors[e],true);
+      s.init(contour.begin());
+      while(s.end() != contour.end())
+	{
+	  Point first = *s.begin();
+	  Point d = *s.end() - first;
+	  bool expected = true;
+	  for(ConstIterator it = s.begin(); it != s.end(); ++it)
+	    {
+	      Point q = *it - first;
+	      long n = q.dot(q);
+	      long c = d[0]*q[1]-d[1]*q[0];
+	      if(2*n >= errors[e]*errors[e]
+		 && !(d == Point(0,0))
+		 && (d.dot(q) < 0 || 2*c*c > (long)errors[e]*errors[e]*d.dot(d)))
+		expected = false;
+	    }
+	  bool flag = s.extendForward();
+	  nbok += (flag == expected) ? 1 : 0;
+	  nb++;
+	  if(!flag)
+	    {
+	      ConstIterator last = s.end();
+	      --last;
+	      s.init(last);
+	    }
+	}
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") width tests" << std::endl;
+
+  // the same shortcuts as the angular cones
+  double errors2[] = { 1, 1.5, 2, 3, 4.2 };
+  for(unsigned int e=0;e<5;e++)
+    for(int w=0;w<2;w++)
+      {
+	std::vector<Shortcut> segments;
+	GreedySegmentation<Shortcut> theSegmentation(contour.begin(), contour.end(), Shortcut(errors2[e],w==1));
+	theSegmentation.getSegments(segments, 1);
+	std::vector<ExactShortcut> exactSegments;
+	GreedySegmentation<ExactShortcut> theExactSegmentation(contour.begin(), contour.end(), ExactShortcut(errors2[e],w==1));
+	theExactSegmentation.getSegments(exactSegments, 1);
+	bool ok = (segments.size() == exactSegments.size());
+	for(unsigned int i=0;i<segments.size() && ok;i++)
+	  ok = (segments[i].begin() == exactSegments[i].begin())
+	    && (segments[i].end() == exactSegments[i].end());
+	nbok += ok ? 1 : 0;
+	nb++;
+	trace.info() << "(" << nbok << "/" << nb << ") "
+		     << exactSegments.size() << " shortcuts for error " << errors2[e]
+		     << (w==1 ? " (width only)" : "") << std::endl;
+      }
+
+  // long directions, whose squared cross products overflow 64 bits
+  typedef ExactShortcut::ExactCone::Direction Direction;
+  ExactShortcut::ExactCone cone(2);
+  cone.insert(Direction(60000,0));
+  nbok += (!cone.contains(Direction(0,60000)) && !cone.contains(Direction(60000,3000000))
+	   && cone.contains(Direction(3000000,0)) && cone.contains(Direction(3000000,70))
+	   && !cone.contains(Direction(3000000,71))) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") long directions" << std::endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 void testFrechetShortcutConceptChecking()
 {
   typedef PointVector<2,int> Point; 
@@ -197,6 +487,34 @@ bool testSegmentation()
     board.saveEPS("FrechetShortcutGreedySegmentationTest.eps", Board2D::BoundingBox, 5000 ); 
   }
   
+  trace.beginBlock ( "Greedy segmentation of the points of an open contour" );
+  {
+    // frechetSimplification segments the contour in its storage: the
+    // last segment ends on its last point, which the points range of a
+    // GridCurve drops when the ends of the contour are not adjacent.
+    typedef std::vector<Point>::const_iterator VectorIterator;
+    typedef FrechetShortcut<VectorIterator,int> VectorSegmentComputer;
+    typedef GreedySegmentation<VectorSegmentComputer> Segmentation;
+    const std::vector<Point> & points = contour;
+    Segmentation theSegmentation( points.begin(), points.end(), VectorSegmentComputer(error) );
+    Segmentation::SegmentComputerIterator it = theSegmentation.begin();
+    Segmentation::SegmentComputerIterator itEnd = theSegmentation.end();
+    VectorIterator last = points.begin();
+    unsigned int nbSegments = 0;
+    for ( ; it != itEnd; ++it, ++nbSegments)
+      {
+        // consecutive segments share their ends
+        nbok += ( it->begin() == last ) ? 1 : 0;
+        nb++;
+        last = it->end() - 1;
+      }
+    trace.info() << nbSegments << " segments, points range of "
+                 << r.size() << " points for " << points.size() << " points" << std::endl;
+    nbok += ( ( last == points.end() - 1 ) && ( r.size() == points.size() - 1 ) ) ? 1 : 0;
+    nb++;
+  }
+  trace.endBlock();
+
   /* Saturated segmentation does not work for FrechetShortcut
      computer. Indeed, given two maximal Frechet shortcuts s1(begin, end) et
      s2(begin, end),  we can have s1.begin < s2.begin < s2.end <
@@ -225,7 +543,7 @@ int main( int argc, char** argv )
 
   testFrechetShortcutConceptChecking();
 
-  bool res = testFrechetShortcut() && testSegmentation(); // && ... other tests
+  bool res = testFrechetShortcut() && testIsExtendableForward() && testCopy() && testCirculator() && testExactCone() && testSegmentation(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,285 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFrechetShortcutHierarchy.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class FrechetShortcutHierarchy.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Circulator.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/curves/FrechetShortcutHierarchy.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef PointVector<2,int> Point;
+typedef std::vector<Point>::const_iterator ConstIterator;
+typedef FrechetShortcutHierarchy<ConstIterator,int> Hierarchy;
+typedef Hierarchy::SegmentComputer Shortcut;
+typedef Hierarchy::Segmentation Segmentation;
+typedef Circulator<ConstIterator> ConstCirculator;
+typedef FrechetShortcutHierarchy<ConstCirculator,int> ClosedHierarchy;
+typedef ClosedHierarchy::SegmentComputer ClosedShortcut;
+typedef ClosedHierarchy::Segmentation ClosedSegmentation;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class FrechetShortcutHierarchy.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * A noisy 4-connected curve, given by its Freeman chain code.
+ */
+std::vector<Point> curve()
+{
+  const std::string code = "11212222212110101012212212223212122122333232221232222232332330303330303033033323003033303000100010101000100000001112121210000101";
+  const Point moves[4] = { Point(1,0), Point(0,1), Point(-1,0), Point(0,-1) };
+  std::vector<Point> contour;
+  Point p(0,0);
+  contour.push_back(p);
+  for(unsigned int i=0;i<code.size();i++)
+    {
+      p += moves[code[i]-'0'];
+      contour.push_back(p);
+    }
+  return contour;
+}
+
+/**
+ * The levels are nested, and the first one is the greedy segmentation.
+ */
+bool testLevels()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  std::vector<Point> contour = curve();
+  std::vector<double> errors;
+  errors.push_back( 2 );
+  errors.push_back( 8 );
+  errors.push_back( 1 );
+  errors.push_back( 4 );
+  errors.push_back( 2 );
+
+  trace.beginBlock ( "Testing the levels ..." );
+  Hierarchy h( errors );
+  h.init( contour.begin(), contour.end(), 3 );
+  trace.info() << h << std::endl;
+
+  nbok += ( h.nbLevels() == 4 && h.error( 0 ) == 8 && h.error( 3 ) == 1
+            && h.levelOf( 4 ) == 1 && h.levelOf( 3 ) == 2 && h.levelOf( 0.5 ) == 3 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "levels sorted by decreasing error" << std::endl;
+
+  // the first level
+  std::vector<Shortcut> segments;
+  Segmentation theSegmentation( contour.begin(), contour.end(), Shortcut( 8 ) );
+  theSegmentation.getSegments( segments, 1 );
+  std::vector<ConstIterator> expected;
+  for ( unsigned int i = 0; i < segments.size(); ++i )
+    expected.push_back( segments[ i ].begin() );
+  expected.push_back( contour.end() - 1 );
+  std::vector<ConstIterator> coarse;
+  h.getVertices( 0, coarse );
+  nbok += ( coarse == expected ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << coarse.size() << " vertices at error 8" << std::endl;
+
+  // each edge is a shortcut of the curve for the error of its level
+  bool edges = true;
+  for ( unsigned int k = 0; k < h.nbLevels(); ++k )
+    {
+      std::vector<ConstIterator> vertices;
+      h.getVertices( k, vertices );
+      for ( unsigned int i = 0; i + 1 < vertices.size(); ++i )
+        {
+          Shortcut s( h.error( k ) );
+          s.init( vertices[ i ] );
+          while ( s.end() != vertices[ i + 1 ] + 1 && s.extendForward() ) {}
+          edges = edges && ( s.end() == vertices[ i + 1 ] + 1 );
+        }
+    }
+  nbok += edges ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "edges within the error of their level" << std::endl;
+
+  // nesting, from the coarsest level to the finest one
+  std::vector<ConstIterator> previous = coarse;
+  for ( unsigned int k = 1; k < h.nbLevels(); ++k )
+    {
+      std::vector<ConstIterator> vertices;
+      h.getVertices( k, vertices );
+      nbok += ( vertices.size() >= previous.size()
+                && std::includes( vertices.begin(), vertices.end(),
+                                  previous.begin(), previous.end() ) ) ? 1 : 0; nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << vertices.size() << " vertices at error " << h.error( k ) << std::endl;
+      previous = vertices;
+    }
+  nbok += ( previous == h.vertices() && previous.front() == contour.begin()
+            && previous.back() == contour.end() - 1 ) ? 1 : 0; nb++;
+
+  // the tags
+  bool ok = true;
+  for ( unsigned int i = 0; i < h.vertices().size(); ++i )
+    {
+      bool inCoarse = std::find( coarse.begin(), coarse.end(), h.vertices()[ i ] ) != coarse.end();
+      ok = ok && ( inCoarse == ( h.tolerance( i ) == 8 ) );
+    }
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "tolerances of the vertices" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Each part of a finer level is the greedy segmentation of the part
+ * of the curve between two vertices of the coarser one.
+ */
+bool testParts()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  std::vector<Point> contour = curve();
+  std::vector<double> errors;
+  errors.push_back( 6 );
+  errors.push_back( 3 );
+
+  trace.beginBlock ( "Testing the parts of a level ..." );
+  Hierarchy h( errors );
+  h.init( contour.begin(), contour.end() );
+  std::vector<ConstIterator> coarse;
+  h.getVertices( 0, coarse );
+  std::vector<ConstIterator> expected;
+  for ( unsigned int j = 0; j + 1 < coarse.size(); ++j )
+    {
+      std::vector<Shortcut> segments;
+      Segmentation theSegmentation( coarse[ j ], coarse[ j + 1 ] + 1, Shortcut( 3 ) );
+      theSegmentation.getSegments( segments, 1 );
+      for ( unsigned int i = 0; i < segments.size(); ++i )
+        if ( segments[ i ].begin() != coarse[ j + 1 ] )
+          expected.push_back( segments[ i ].begin() );
+    }
+  expected.push_back( coarse.back() );
+  nbok += ( h.vertices() == expected ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << h << std::endl;
+
+  // a single point
+  h.init( contour.begin(), contour.begin() + 1 );
+  nbok += ( h.vertices().size() == 1 && h.level( 0 ) == 0 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "single point" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * The polylines of a closed curve, given by a circulator, are closed:
+ * the first level is the greedy segmentation of the whole loop, and
+ * each level has an edge back to its first vertex.
+ */
+bool testClosed()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  // the curve goes back to its first point
+  std::vector<Point> contour = curve();
+  contour.pop_back();
+  ConstCirculator c( contour.begin(), contour.begin(), contour.end() );
+
+  trace.beginBlock ( "Testing a closed curve ..." );
+  double errors[] = { 1000, 4, 2, 1 };
+  for ( unsigned int e = 0; e < 2; ++e )
+    {
+      // with a first level of one vertex (e == 0) or more
+      ClosedHierarchy h( std::vector<double>( errors + e, errors + 4 ) );
+      h.init( c, c );
+      std::vector<ClosedShortcut> segments;
+      ClosedSegmentation theSegmentation( c, c, ClosedShortcut( errors[ e ] ) );
+      theSegmentation.getSegments( segments, 1 );
+      std::vector<ConstCirculator> expected;
+      for ( unsigned int i = 0; i < segments.size(); ++i )
+        expected.push_back( segments[ i ].begin() );
+      std::vector<ConstCirculator> previous;
+      h.getVertices( 0, previous );
+      nbok += ( previous == expected ) ? 1 : 0; nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << previous.size() << " vertices at error " << errors[ e ] << std::endl;
+
+      for ( unsigned int k = 0; k < h.nbLevels(); ++k )
+        {
+          std::vector<ConstCirculator> vertices;
+          h.getVertices( k, vertices );
+          // nested levels
+          bool ok = vertices.size() >= previous.size();
+          for ( unsigned int i = 0; ok && i < previous.size(); ++i )
+            ok = std::find( vertices.begin(), vertices.end(), previous[ i ] ) != vertices.end();
+          // the edges, including the last one, are shortcuts
+          for ( unsigned int i = 0; ok && vertices.size() > 1 && i < vertices.size(); ++i )
+            {
+              ConstCirculator next( vertices[ ( i + 1 ) % vertices.size() ] );
+              ++next;
+              ClosedShortcut s( h.error( k ) );
+              s.init( vertices[ i ] );
+              while ( s.end() != next && s.extendForward() ) {}
+              ok = ( s.end() == next );
+            }
+          nbok += ok ? 1 : 0; nb++;
+          trace.info() << "(" << nbok << "/" << nb << ") "
+                       << vertices.size() << " closed vertices at error " << h.error( k ) << std::endl;
+          previous = vertices;
+        }
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class FrechetShortcutHierarchy" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testLevels() && testParts() && testClosed(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -49,7 +49,10 @@
 
 #include "DGtal/base/Circulator.h"
 
+#include "DGtal/helpers/StdDefs.h"
 #include "DGtal/geometry/curves/ArithmeticalDSS.h"
+#include "DGtal/geometry/curves/GeometricalDSS.h"
+#include "DGtal/geometry/curves/FrechetShortcut.h"
 #include "DGtal/geometry/curves/FreemanChain.h"
 #include "DGtal/geometry/curves/GreedySegmentation.h"
 #include "DGtal/geometry/curves/SaturatedSegmentation.h"
@@ -937,6 +940,92 @@ bool SaturatedSegmentationTest()
   return (compteur == 4295);
 }
 
+/**
+ * Compares the segments computed by chunks with the sequential ones.
+ */
+template <typename Segmentation>
+bool sameSegmentsByChunks(const Segmentation& s, const std::string& aName)
+{
+  typedef typename Segmentation::SegmentComputer SegmentComputer;
+  std::vector<SegmentComputer> sequential;
+  for (typename Segmentation::SegmentComputerIterator i = s.begin(); 
+       i != s.end(); ++i) 
+    sequential.push_back(*i);
+
+  unsigned int nbChunks[] = { 1, 2, 7, 64 };
+  bool res = true; 
+  for (unsigned int k = 0; k < 4; ++k) {
+    std::vector<SegmentComputer> segments;
+    s.getSegments(segments, nbChunks[k]);
+    bool same = (segments.size() == sequential.size());
+    for (unsigned int j = 0; same && j < segments.size(); ++j)
+      same = (segments[j].begin() == sequential[j].begin())
+        && (segments[j].end() == sequential[j].end());
+    trace.info() << aName << " " << nbChunks[k] << " chunks: " 
+                 << segments.size() << " segments " 
+                 << (same ? "ok" : "differ") << endl;
+    res = res && same; 
+  }
+  return res; 
+}
+
+/**
+ * Segmentation by chunks versus sequential segmentation
+ */
+bool greedySegmentationByChunksTest()
+{
+  typedef int Coordinate;
+  typedef FreemanChain<Coordinate> FC; 
+  typedef PointVector<2,Coordinate> Point; 
+
+  std::string filename = testPath + "samples/BigBall2.fc";
+  std::fstream fst;
+  fst.open (filename.c_str(), std::ios::in);
+  FC fc(fst);
+  vector<Point> vPts; 
+  vPts.assign(fc.begin(),fc.end()); 
+  vPts.resize(10000); //part of the curve 
+
+  trace.beginBlock("Greedy segmentation by chunks");
+  trace.info() << filename << " " << vPts.size() << " points" << endl;
+  bool res = true; 
+
+  typedef vector<Point>::const_iterator ConstIterator; 
+  {
+    typedef ArithmeticalDSS<ConstIterator,Coordinate,4> SegmentComputer;
+    typedef GreedySegmentation<SegmentComputer> Segmentation;
+    Segmentation s(vPts.begin(), vPts.end(), SegmentComputer());
+    res = res && sameSegmentsByChunks(s, "ArithmeticalDSS"); 
+    ConstIterator itb = vPts.begin() + 1000; 
+    ConstIterator ite = vPts.end() - 1000; 
+    s.setSubRange(itb, ite); 
+    res = res && sameSegmentsByChunks(s, "ArithmeticalDSS Truncate"); 
+    s.setMode("Truncate+1"); 
+    res = res && sameSegmentsByChunks(s, "ArithmeticalDSS Truncate+1"); 
+    s.setMode("DoNotTruncate"); 
+    res = res && sameSegmentsByChunks(s, "ArithmeticalDSS DoNotTruncate"); 
+  }
+  {
+    typedef FrechetShortcut<ConstIterator,Coordinate> SegmentComputer;
+    typedef GreedySegmentation<SegmentComputer> Segmentation;
+    Segmentation s(vPts.begin(), vPts.end(), SegmentComputer(3));
+    res = res && sameSegmentsByChunks(s, "FrechetShortcut"); 
+  }
+  {
+    Z2i::Curve c; 
+    c.initFromVector(vPts); 
+    typedef Z2i::Curve::IncidentPointsRange Range; 
+    Range r = c.getIncidentPointsRange(); 
+    typedef GeometricalDSS<Range::ConstIterator> SegmentComputer;
+    typedef GreedySegmentation<SegmentComputer> Segmentation;
+    Segmentation s(r.begin(), r.end(), SegmentComputer());
+    res = res && sameSegmentsByChunks(s, "GeometricalDSS"); 
+  }
+
+  trace.endBlock();
+  return res;
+}
+
 /////////////////////////////////////////////////////////////////////////
 //////////////// MAIN ///////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////
@@ -953,6 +1042,7 @@ int main(int argc, char **argv)
   bool res = greedySegmentationVisualTest()
 && SaturatedSegmentationVisualTest()
 && SaturatedSegmentationTest()
+&& greedySegmentationByChunksTest()
 ;
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
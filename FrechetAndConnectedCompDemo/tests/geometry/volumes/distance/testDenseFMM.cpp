@@ -0,0 +1,314 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDenseFMM.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class DenseFMM: same results as FMM.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
+#include "DGtal/kernel/domains/DomainPredicate.h"
+#include "DGtal/kernel/sets/DigitalSetFromMap.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/kernel/sets/DigitalSetByBitGrid.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/geometry/volumes/distance/FMM.h"
+#include "DGtal/geometry/volumes/distance/DenseFMM.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DenseFMM.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Points at distance at most a radius from the origin.
+ */
+template <typename TPoint>
+struct BallPredicate
+{
+  typedef TPoint Point;
+  BallPredicate( double aR ) : myR( aR ) {}
+  bool operator()( const Point & p ) const
+  {
+    double n2 = 0;
+    for ( typename Point::Dimension k = 0; k < Point::dimension; ++k )
+      n2 += (double) p[ k ] * p[ k ];
+    return std::sqrt( n2 ) <= myR;
+  }
+  double myR;
+};
+
+/**
+ * Signed distance to the ball of BallPredicate.
+ */
+template <typename TPoint>
+struct BallFunctor
+{
+  typedef TPoint Point;
+  typedef double Value;
+  BallFunctor( double aR ) : myR( aR ) {}
+  Value operator()( const Point & p ) const
+  {
+    double n2 = 0;
+    for ( typename Point::Dimension k = 0; k < Point::dimension; ++k )
+      n2 += (double) p[ k ] * p[ k ];
+    return std::sqrt( n2 ) - myR;
+  }
+  double myR;
+};
+
+/**
+ * @return 'true' if both sets have the same points, with the same
+ * values in both images.
+ */
+template <typename TImage1, typename TSet1, typename TImage2, typename TSet2>
+bool sameValues( const TImage1 & image1, const TSet1 & set1,
+                 const TImage2 & image2, const TSet2 & set2 )
+{
+  if ( set1.size() != set2.size() ) return false;
+  for ( typename TSet1::ConstIterator it = set1.begin(), itEnd = set1.end();
+        it != itEnd; ++it )
+    if ( ( set2.find( *it ) == set2.end() ) || ( image1( *it ) != image2( *it ) ) )
+      return false;
+  return true;
+}
+
+/**
+ * Distance from a point, with and without thresholds, in dimension
+ * 2 and 3: the points are accepted in the same order as FMM, with
+ * the same values.
+ */
+template <DGtal::Dimension dim>
+bool testFromPoint( int size )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Distance from a point" );
+
+  typedef HyperRectDomain< SpaceND<dim, int> > Domain;
+  typedef typename Domain::Point Point;
+  Domain d( Point::diagonal( -size ), Point::diagonal( size ) );
+  DomainPredicate<Domain> dp( d );
+
+  typedef ImageContainerBySTLMap<Domain, double> Map;
+  typedef DigitalSetFromMap<Map> MapSet;
+  typedef ImageContainerBySTLVector<Domain, double> Image;
+  typedef DigitalSetByBitGrid<Domain> Set;
+  typedef FMM<Map, MapSet, DomainPredicate<Domain> > FMM;
+  typedef DenseFMM<Image, Set, DomainPredicate<Domain> > DenseFMM;
+
+  unsigned long area = (unsigned long) d.size() + 1;
+  unsigned long areas[ 3 ] = { area, area, area / 3 };
+  double distances[ 3 ] = { 2.0 * size, size * 0.5, 2.0 * size };
+  for ( unsigned int i = 0; i < 3; ++i )
+    {
+      Map map( d );
+      MapSet mapSet( map );
+      insertAndSetValue( map, mapSet, Point::diagonal( 0 ), 0.0 );
+      Image image( d );
+      Set set( d );
+      insertAndSetValue( image, set, Point::diagonal( 0 ), 0.0 );
+
+      FMM fmm( map, mapSet, dp, areas[ i ], distances[ i ] );
+      DenseFMM dense( image, set, dp, areas[ i ], distances[ i ] );
+      bool sameSteps = true;
+      Point p1, p2;
+      double v1, v2;
+      bool step1 = true;
+      while ( step1 && sameSteps )
+        {
+          step1 = fmm.computeOneStep( p1, v1 );
+          bool step2 = dense.computeOneStep( p2, v2 );
+          sameSteps = ( step1 == step2 ) && ( ! step1 || ( ( p1 == p2 ) && ( v1 == v2 ) ) );
+        }
+      trace.info() << fmm << std::endl;
+      trace.info() << dense << std::endl;
+      nbok += ( sameSteps && sameValues( map, mapSet, image, set )
+                && dense.isValid() && ( dense.min() == fmm.min() )
+                && ( dense.max() == fmm.max() ) ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") same steps, area "
+                   << areas[ i ] << ", distance " << distances[ i ] << std::endl;
+    }
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Signed distance to a circle, inside and outside, with the first
+ * and the second order functors.
+ */
+bool testSignedDistance( int size )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Signed distance to a circle" );
+
+  typedef HyperRectDomain< SpaceND<2, int> > Domain;
+  typedef Domain::Point Point;
+  Domain d( Point::diagonal( -size ), Point::diagonal( size ) );
+  DomainPredicate<Domain> dp( d );
+  double radius = size / 2;
+  BallPredicate<Point> ball( radius );
+  BallFunctor<Point> functor( radius );
+
+  typedef KhalimskySpaceND< 2, int > KSpace;
+  KSpace K;
+  K.init( Point::diagonal( -size ), Point::diagonal( size ), true );
+  SurfelAdjacency<KSpace::dimension> SAdj( true );
+  KSpace::SCell bel = Surfaces<KSpace>::findABel( K, ball, 10000 );
+  std::vector<KSpace::SCell> bels;
+  Surfaces<KSpace>::track2DBoundary( bels, K, SAdj, ball, bel );
+
+  typedef ImageContainerBySTLMap<Domain, double> Map;
+  typedef DigitalSetFromMap<Map> MapSet;
+  typedef ImageContainerBySTLVector<Domain, double> Image;
+  typedef DigitalSetBySTLSet<Domain> Set;
+
+  {
+    typedef FMM<Map, MapSet, DomainPredicate<Domain> > FMM;
+    typedef DenseFMM<Image, Set, DomainPredicate<Domain> > DenseFMM;
+    Map map( d );
+    MapSet mapSet( map );
+    FMM::initFromBelsRange( K, bels.begin(), bels.end(), map, mapSet, 0.5 );
+    Image image( d );
+    Set set( d );
+    DenseFMM::initFromBelsRange( K, bels.begin(), bels.end(), image, set, 0.5 );
+    FMM fmm( map, mapSet, dp );
+    fmm.compute();
+    DenseFMM dense( image, set, dp );
+    dense.compute();
+    trace.info() << dense << std::endl;
+    nbok += ( sameValues( map, mapSet, image, set ) && dense.isValid()
+              && ( dense.min() < 0 ) && ( dense.max() > 0 ) ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") first order" << std::endl;
+  }
+
+  {
+    typedef L2SecondOrderLocalDistance<Map, MapSet> Distance;
+    typedef L2SecondOrderLocalDistance<Image, Set> DenseDistance;
+    typedef FMM<Map, MapSet, DomainPredicate<Domain>, Distance> FMM;
+    typedef DenseFMM<Image, Set, DomainPredicate<Domain>, DenseDistance> DenseFMM;
+    Map map( d );
+    MapSet mapSet( map );
+    FMM::initFromBelsRange( K, bels.begin(), bels.end(), functor, map, mapSet );
+    Image image( d );
+    Set set( d );
+    DenseFMM::initFromBelsRange( K, bels.begin(), bels.end(), functor, image, set );
+    Distance distance( map, mapSet );
+    DenseDistance denseDistance( image, set );
+    FMM fmm( map, mapSet, dp, distance );
+    fmm.compute();
+    DenseFMM dense( image, set, dp, denseDistance );
+    dense.compute();
+    trace.info() << dense << std::endl;
+    nbok += ( sameValues( map, mapSet, image, set ) && dense.isValid() ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") second order" << std::endl;
+  }
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Bounded propagation in a ball: no candidate beyond the threshold,
+ * and the l_1 distance is exact.
+ */
+bool testBounded( int size )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Bounded propagation" );
+
+  typedef HyperRectDomain< SpaceND<3, int> > Domain;
+  typedef Domain::Point Point;
+  Domain d( Point::diagonal( -size ), Point::diagonal( size ) );
+  BallPredicate<Point> ball( size );
+
+  typedef ImageContainerBySTLVector<Domain, long> Image;
+  typedef DigitalSetByBitGrid<Domain> Set;
+  typedef L1LocalDistance<Image, Set> Distance;
+  typedef DenseFMM<Image, Set, BallPredicate<Point>, Distance> DenseFMM;
+  Image image( d );
+  Set set( d );
+  insertAndSetValue( image, set, Point::diagonal( 0 ), 0 );
+  Distance distance( image, set );
+  long bound = size / 2;
+  DenseFMM dense( image, set, ball, d.size() + 1, bound, distance );
+  dense.compute();
+  trace.info() << dense << std::endl;
+
+  bool ok = dense.isValid() && ( dense.nbCandidates() == 0 ) && ( dense.max() == bound - 1 );
+  unsigned long inside = 0;
+  for ( Domain::ConstIterator it = d.begin(), itEnd = d.end(); it != itEnd; ++it )
+    {
+      long l1 = std::abs( (*it)[ 0 ] ) + std::abs( (*it)[ 1 ] ) + std::abs( (*it)[ 2 ] );
+      bool accepted = set.find( *it ) != set.end();
+      if ( l1 < bound )
+        ++inside;
+      ok = ok && ( accepted == ( l1 < bound ) ) && ( ! accepted || ( image( *it ) == l1 ) );
+    }
+  nbok += ( ok && ( set.size() == inside ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << set.size()
+               << " points below the bound" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class DenseFMM" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testFromPoint<2>( 30 ) && testFromPoint<3>( 10 )
+    && testSignedDistance( 30 ) && testBounded( 12 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,220 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFMM-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * FMM compared to DenseFMM on the scenarios of testFMM.cpp, with
+ * bigger domains: distance from a point in 2D and 3D, l_1 distance
+ * in 3D, signed distance to a circle, and a bounded propagation.
+ *
+ * Usage: testFMM-benchmark [size2d [size3d]]
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <string>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/DomainPredicate.h"
+#include "DGtal/kernel/sets/DigitalSetFromMap.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/kernel/sets/DigitalSetByBitGrid.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/geometry/volumes/distance/FMM.h"
+#include "DGtal/geometry/volumes/distance/DenseFMM.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+/**
+ * Points of the disk of radius myR centered at the origin.
+ */
+template <typename TPoint>
+struct BallPredicate
+{
+  typedef TPoint Point;
+  BallPredicate( double aR ) : myR( aR ) {}
+  bool operator()( const Point & p ) const
+  {
+    return (double) p[ 0 ] * p[ 0 ] + (double) p[ 1 ] * p[ 1 ] <= myR * myR;
+  }
+  double myR;
+};
+
+/**
+ * @return 'true' if both sets have the same points, with the same
+ * values in both images.
+ */
+template <typename TImage1, typename TSet1, typename TImage2, typename TSet2>
+bool sameValues( const TImage1 & image1, const TSet1 & set1,
+                 const TImage2 & image2, const TSet2 & set2 )
+{
+  if ( set1.size() != set2.size() ) return false;
+  for ( typename TSet1::ConstIterator it = set1.begin(), itEnd = set1.end();
+        it != itEnd; ++it )
+    if ( ( set2.find( *it ) == set2.end() ) || ( image1( *it ) != image2( *it ) ) )
+      return false;
+  return true;
+}
+
+/**
+ * Prints a line of results.
+ */
+void print( const std::string & scenario, unsigned long nbPoints,
+            double tFMM, double tDense, bool same )
+{
+  std::cout << scenario << " " << nbPoints << " " << tFMM << " " << tDense << " "
+            << tFMM / tDense << " " << ( same ? "same" : "DIFFERENT" ) << std::endl;
+}
+
+/**
+ * Distance from the center of a cube of side 2*size+1, for the
+ * point functor TDistance (L2FirstOrderLocalDistance or
+ * L1LocalDistance), with FMM on a map image (as in testFMM.cpp)
+ * and DenseFMM on a vector image.
+ */
+template <DGtal::Dimension dim, typename TValue,
+          template <typename, typename> class TDistance>
+bool fromPoint( const std::string & scenario, int size, TValue distance )
+{
+  typedef HyperRectDomain< SpaceND<dim, int> > Domain;
+  typedef typename Domain::Point Point;
+  Domain d( Point::diagonal( -size ), Point::diagonal( size ) );
+  DomainPredicate<Domain> dp( d );
+  unsigned long area = (unsigned long) d.size() + 1;
+
+  typedef ImageContainerBySTLMap<Domain, TValue> Map;
+  typedef DigitalSetFromMap<Map> MapSet;
+  typedef TDistance<Map, MapSet> MapDistance;
+  Map map( d );
+  MapSet mapSet( map );
+  insertAndSetValue( map, mapSet, Point::diagonal( 0 ), (TValue) 0 );
+  Clock c;
+  c.startClock();
+  MapDistance mapDistance( map, mapSet );
+  FMM<Map, MapSet, DomainPredicate<Domain>, MapDistance>
+    fmm( map, mapSet, dp, area, distance, mapDistance );
+  fmm.compute();
+  double tFMM = c.stopClock();
+
+  typedef ImageContainerBySTLVector<Domain, TValue> Image;
+  typedef DigitalSetByBitGrid<Domain> Set;
+  typedef TDistance<Image, Set> Distance;
+  Image image( d );
+  Set set( d );
+  insertAndSetValue( image, set, Point::diagonal( 0 ), (TValue) 0 );
+  c.startClock();
+  Distance denseDistance( image, set );
+  DenseFMM<Image, Set, DomainPredicate<Domain>, Distance>
+    dense( image, set, dp, area, distance, denseDistance );
+  dense.compute();
+  double tDense = c.stopClock();
+
+  bool same = sameValues( map, mapSet, image, set );
+  print( scenario, set.size(), tFMM, tDense, same );
+  return same;
+}
+
+/**
+ * Signed distance to a circle of radius size/2, computed from the
+ * points incident to its boundary in the square of side 2*size+1.
+ */
+bool fromCircle( int size )
+{
+  typedef HyperRectDomain< SpaceND<2, int> > Domain;
+  typedef Domain::Point Point;
+  Domain d( Point::diagonal( -size ), Point::diagonal( size ) );
+  DomainPredicate<Domain> dp( d );
+  BallPredicate<Point> ball( size / 2 );
+
+  typedef KhalimskySpaceND< 2, int > KSpace;
+  KSpace K;
+  K.init( Point::diagonal( -size ), Point::diagonal( size ), true );
+  SurfelAdjacency<KSpace::dimension> SAdj( true );
+  KSpace::SCell bel = Surfaces<KSpace>::findABel( K, ball, 100000 );
+  std::vector<KSpace::SCell> bels;
+  Surfaces<KSpace>::track2DBoundary( bels, K, SAdj, ball, bel );
+
+  typedef ImageContainerBySTLMap<Domain, double> Map;
+  typedef DigitalSetFromMap<Map> MapSet;
+  typedef FMM<Map, MapSet, DomainPredicate<Domain> > FMM;
+  Map map( d );
+  MapSet mapSet( map );
+  FMM::initFromBelsRange( K, bels.begin(), bels.end(), map, mapSet, 0.5 );
+  Clock c;
+  c.startClock();
+  FMM fmm( map, mapSet, dp );
+  fmm.compute();
+  double tFMM = c.stopClock();
+
+  typedef ImageContainerBySTLVector<Domain, double> Image;
+  typedef DigitalSetByBitGrid<Domain> Set;
+  typedef DenseFMM<Image, Set, DomainPredicate<Domain> > DenseFMM;
+  Image image( d );
+  Set set( d );
+  DenseFMM::initFromBelsRange( K, bels.begin(), bels.end(), image, set, 0.5 );
+  c.startClock();
+  DenseFMM dense( image, set, dp );
+  dense.compute();
+  double tDense = c.stopClock();
+
+  bool same = sameValues( map, mapSet, image, set );
+  print( "circle2d", set.size(), tFMM, tDense, same );
+  return same;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmark of FMM and DenseFMM" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  int size2d = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 400;
+  int size3d = ( argc > 2 ) ? atoi( argv[ 2 ] ) : 50;
+
+  std::cout << "# scenario acceptedPoints FMM(ms) DenseFMM(ms) speedup" << std::endl;
+  bool res = fromPoint<2, double, L2FirstOrderLocalDistance>( "point2d", size2d, 2.0 * size2d )
+    && fromCircle( size2d )
+    && fromPoint<3, double, L2FirstOrderLocalDistance>( "point3d", size3d, 2.0 * size3d )
+    && fromPoint<3, double, L2FirstOrderLocalDistance>( "bounded3d", size3d, size3d / 4.0 )
+    && fromPoint<3, long, L1LocalDistance>( "l1-3d", size3d, 3 * size3d + 1 );
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -29,10 +29,13 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <cstdlib>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/geometry/volumes/distance/PowerMap.h"
 #include "DGtal/geometry/volumes/distance/ReducedMedialAxis.h"
+#include "DGtal/geometry/volumes/distance/ReverseDistanceTransformation.h"
 #include "DGtal/geometry/volumes/distance/ExactPredicateLpPowerSeparableMetric.h"
 #include "DGtal/kernel/sets/DigitalSetDomain.h"
 ///////////////////////////////////////////////////////////////////////////////
@@ -136,6 +139,86 @@ bool testReducedMedialAxis()
   return nbok == nb;
 }
 
+/**
+ * Medial balls of a union of random balls, extracted from a
+ * ReverseDistanceTransformation: they reconstruct the shape and they
+ * are the points of the medial axis image.
+ */
+bool testMedialBalls()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing medial balls ..." );
+
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 31, 27, 23 ) );
+  Z3i::DigitalSet set( domain );
+  srand( 3 );
+  std::vector< std::pair<Z3i::Point, DGtal::int64_t> > input;
+  for ( unsigned int i = 0; i < 40; ++i )
+    {
+      Z3i::Point c( rand() % 32, rand() % 28, rand() % 24 );
+      if ( set.find( c ) == set.end() )
+        {
+          set.insertNew( c );
+          input.push_back( std::make_pair( c, (DGtal::int64_t) ( 1 + rand() % 40 ) ) );
+        }
+    }
+  DigitalSetDomain<Z3i::DigitalSet> setDomain( set );
+  typedef ImageContainerBySTLMap<DigitalSetDomain<Z3i::DigitalSet>, DGtal::int64_t> Image;
+  Image image( setDomain );
+  for ( unsigned int i = 0; i < input.size(); ++i )
+    image.setValue( input[ i ].first, input[ i ].second );
+
+  Z3i::L2PowerMetric l2power;
+  typedef ReverseDistanceTransformation<Image, Z3i::L2PowerMetric> RDT;
+  typedef ReducedMedialAxis<RDT> MA;
+  RDT rdt( &domain, &image, &l2power );
+  MA::Balls balls;
+  MA::getReducedMedialAxisBalls( rdt, balls );
+  trace.info() << balls.size() << " medial balls out of " << input.size() << std::endl;
+
+  // Sorted balls of the input.
+  bool ok = ! balls.empty();
+  for ( unsigned int i = 0; i < balls.size(); ++i )
+    ok = ok && ( image.domain().isInside( balls[ i ].first ) )
+      && ( image( balls[ i ].first ) == balls[ i ].second )
+      && ( ( i == 0 ) || ( balls[ i - 1 ].first < balls[ i ].first ) );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") sorted input balls" << std::endl;
+
+  // The medial balls reconstruct the shape of the reverse DT.
+  bool same = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        same && ( it != itend ); ++it )
+    {
+      bool inBall = false;
+      for ( unsigned int i = 0; ( ! inBall ) && ( i < balls.size() ); ++i )
+        inBall = l2power.powerDistance( *it, balls[ i ].first, balls[ i ].second ) < 0;
+      same = ( inBall == ( rdt( *it ) < 0 ) );
+    }
+  nbok += same ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") same reconstruction" << std::endl;
+
+  // Same medial axis from a power map.
+  typedef PowerMap<Image, Z3i::L2PowerMetric> Power;
+  Power power( &domain, &image, &l2power );
+  ReducedMedialAxis<Power>::Balls powerBalls;
+  ReducedMedialAxis<Power>::getReducedMedialAxisBalls( power, powerBalls );
+  ReducedMedialAxis<Power>::Type rdma
+    = ReducedMedialAxis<Power>::getReducedMedialAxisFromPowerMap( power );
+  ok = ( powerBalls == balls );
+  for ( unsigned int i = 0; i < balls.size(); ++i )
+    ok = ok && ( rdma( balls[ i ].first ) == balls[ i ].second );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") same medial axis from the power map" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -147,7 +230,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testReducedMedialAxis(); // && ... other tests
+  bool res = testReducedMedialAxis() && testMedialBalls(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
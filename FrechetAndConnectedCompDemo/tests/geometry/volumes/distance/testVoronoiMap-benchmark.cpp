@@ -0,0 +1,175 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testVoronoiMap-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Scaling of the VoronoiMap computation with the volume size and,
+ * when OpenMP is enabled, with the number of threads. Time of the
+ * update of an incremental map after local edits.
+ *
+ * Usage: testVoronoiMap-benchmark [side1 side2 ...]
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <set>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+/**
+ * About one site every 1009 points.
+ */
+struct SparseSites
+{
+  typedef Z3i::Point Point;
+  bool operator()( const Point & p ) const
+  {
+    return ( p[ 0 ] * 7 + p[ 1 ] * 13 + p[ 2 ] * 31 ) % 1009 != 0;
+  }
+};
+
+/**
+ * SparseSites with some points toggled.
+ */
+struct EditedSites
+{
+  typedef Z3i::Point Point;
+  bool operator()( const Point & p ) const
+  {
+    return mySites( p ) == ( myToggled.find( p ) == myToggled.end() );
+  }
+  SparseSites mySites;
+  std::set<Point> myToggled;
+};
+
+/**
+ * @return the time in ms of the l_p Voronoi map of a cube.
+ */
+template <DGtal::uint32_t p>
+double voronoiTime( Z3i::Integer side )
+{
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, p> Metric;
+  Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( side - 1 ) );
+  SparseSites sites;
+  Metric metric;
+  Clock c;
+  c.startClock();
+  VoronoiMap<Z3i::Space, SparseSites, Metric> voro( domain, sites, metric );
+  return c.stopClock();
+}
+
+/**
+ * Toggles 300 points in a box of side 8 at the center of a cube,
+ * then updates its incremental l_2 Voronoi map.
+ */
+void updateTimes( Z3i::Integer side, double & tFull, double & tUpdate,
+                  Z3i::Domain::Size & nbRows )
+{
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> Metric;
+  Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( side - 1 ) );
+  EditedSites sites;
+  Metric metric;
+  Clock c;
+  c.startClock();
+  VoronoiMap<Z3i::Space, EditedSites, Metric> voro( domain, sites, metric, true );
+  tFull = c.stopClock();
+  Z3i::Point lower = Z3i::Point::diagonal( side / 2 - 4 );
+  Z3i::Point upper = Z3i::Point::diagonal( side / 2 + 3 );
+  Z3i::Domain box( lower, upper );
+  unsigned int i = 0;
+  for ( Z3i::Domain::ConstIterator it = box.begin(), itend = box.end();
+        it != itend; ++it, ++i )
+    if ( i % 5 < 3 && sites.myToggled.size() < 300 )
+      sites.myToggled.insert( *it );
+  c.startClock();
+  nbRows = voro.update( lower, upper );
+  tUpdate = c.stopClock();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmark of VoronoiMap" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  std::vector<Z3i::Integer> sides;
+  for ( int i = 1; i < argc; ++i )
+    sides.push_back( atoi( argv[ i ] ) );
+  if ( sides.empty() )
+    {
+      sides.push_back( 64 );
+      sides.push_back( 128 );
+      sides.push_back( 256 );
+    }
+  std::vector<int> threads( 1, 1 );
+#ifdef WITH_OPENMP
+  for ( int t = 2; t <= omp_get_max_threads(); t *= 2 )
+    threads.push_back( t );
+#endif
+
+  std::cout << "# side threads l2(ms) l2(Mvox/s) l3(ms) l3(Mvox/s)" << std::endl;
+  for ( unsigned int s = 0; s < sides.size(); ++s )
+    for ( unsigned int t = 0; t < threads.size(); ++t )
+      {
+#ifdef WITH_OPENMP
+        omp_set_num_threads( threads[ t ] );
+#endif
+        double mvoxels = (double) sides[ s ] * sides[ s ] * sides[ s ] / 1e6;
+        double t2 = voronoiTime<2>( sides[ s ] );
+        double t3 = voronoiTime<3>( sides[ s ] );
+        std::cout << sides[ s ] << " " << threads[ t ] << " "
+                  << t2 << " " << mvoxels / t2 * 1000 << " "
+                  << t3 << " " << mvoxels / t3 * 1000 << std::endl;
+      }
+
+  std::cout << "# side incrementalBuild(ms) update(ms) updatedRows" << std::endl;
+  for ( unsigned int s = 0; s < sides.size(); ++s )
+    {
+      double tFull, tUpdate;
+      Z3i::Domain::Size nbRows;
+      updateTimes( sides[ s ], tFull, tUpdate, nbRows );
+      std::cout << sides[ s ] << " " << tFull << " " << tUpdate << " " << nbRows << std::endl;
+    }
+
+  trace.emphase() << "Passed." << endl;
+  trace.endBlock();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -30,6 +30,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/images/CConstImage.h"
 #include "DGtal/geometry/volumes/distance/VoronoiMap.h"
@@ -548,6 +549,205 @@ bool testSimple4D()
 }
 
 
+/**
+ * Voronoi map for the metric l_p of random sites in a domain whose
+ * extents are not multiples of the tile width: each point must be
+ * mapped to a site at least as close as any other site.
+ */
+template <typename TSpace, DGtal::uint32_t p>
+bool testVoronoiMapLp( const HyperRectDomain<TSpace> & domain,
+                       const unsigned int nbSites )
+{
+  typedef HyperRectDomain<TSpace> Domain;
+  typedef typename TSpace::Point Point;
+  typedef DigitalSetBySTLSet<Domain> Set;
+  typedef ExactPredicateLpSeparableMetric<TSpace, p> Metric;
+  
+  Set sites( domain );
+  for ( unsigned int i = 0; i < nbSites; ++i )
+    {
+      Point q;
+      for ( Dimension k = 0; k < TSpace::dimension; ++k )
+        q[ k ] = domain.lowerBound()[ k ]
+          + rand() % ( domain.upperBound()[ k ] - domain.lowerBound()[ k ] + 1 );
+      sites.insert( q );
+    }
+  Set set( domain );
+  for ( typename Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    if ( sites.find( *it ) == sites.end() )
+      set.insertNew( *it );
+
+  Metric metric;
+  VoronoiMap<TSpace, Set, Metric> voro( domain, set, metric );
+  
+  for ( typename Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    {
+      Point site = voro( *it );
+      if ( sites.find( site ) == sites.end() )
+        {
+          trace.error() << "l_" << p << ": " << *it << " mapped to " << site
+                        << ", not a site" << std::endl;
+          return false;
+        }
+      double d = metric( *it, site );
+      for ( typename Set::ConstIterator itSite = sites.begin(), itSiteEnd = sites.end();
+            itSite != itSiteEnd; ++itSite )
+        if ( metric( *it, *itSite ) < d )
+          {
+            trace.error() << "l_" << p << ": " << *it << " mapped to " << site
+                          << " (" << d << ") closer to " << *itSite << std::endl;
+            return false;
+          }
+    }
+  return true;
+}
+
+bool testTiles()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock("Voronoi maps l_1 to l_4 by tiles");
+  Z2i::Domain domain2( Z2i::Point( -3, 2 ), Z2i::Point( 40, 30 ) );
+  Z3i::Domain domain3( Z3i::Point( 1, -2, 0 ), Z3i::Point( 20, 36, 18 ) );
+  nbok += ( testVoronoiMapLp<Z2i::Space, 1>( domain2, 20 )
+            && testVoronoiMapLp<Z2i::Space, 2>( domain2, 20 )
+            && testVoronoiMapLp<Z2i::Space, 3>( domain2, 20 )
+            && testVoronoiMapLp<Z2i::Space, 4>( domain2, 20 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "2D Voronoi maps are valid" << std::endl;
+  nbok += ( testVoronoiMapLp<Z3i::Space, 1>( domain3, 30 )
+            && testVoronoiMapLp<Z3i::Space, 2>( domain3, 30 )
+            && testVoronoiMapLp<Z3i::Space, 3>( domain3, 30 )
+            && testVoronoiMapLp<Z3i::Space, 4>( domain3, 30 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "3D Voronoi maps are valid" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+
+/**
+ * Incremental map: sites are toggled in small boxes, the updated map
+ * must be the same as a map built from scratch.
+ */
+template <typename TSpace, DGtal::uint32_t p>
+bool testIncrementalLp( const HyperRectDomain<TSpace> & domain,
+                        const unsigned int nbEdits )
+{
+  typedef HyperRectDomain<TSpace> Domain;
+  typedef typename TSpace::Point Point;
+  typedef DigitalSetBySTLSet<Domain> Set;
+  typedef ExactPredicateLpSeparableMetric<TSpace, p> Metric;
+  typedef VoronoiMap<TSpace, Set, Metric> Voro;
+  
+  Set set( domain );
+  for ( typename Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    if ( rand() % 50 != 0 )
+      set.insertNew( *it );
+  Metric metric;
+  Voro voro( domain, set, metric, true );
+  
+  typename Domain::Size nbRows = 0;
+  for ( unsigned int e = 0; e < nbEdits; ++e )
+    {
+      //Toggles a few points of a box of side 3.
+      Point lower, upper;
+      for ( Dimension k = 0; k < TSpace::dimension; ++k )
+        {
+          lower[ k ] = domain.lowerBound()[ k ]
+            + rand() % ( domain.upperBound()[ k ] - domain.lowerBound()[ k ] - 1 );
+          upper[ k ] = lower[ k ] + 2;
+        }
+      Domain box( lower, upper );
+      for ( typename Domain::ConstIterator it = box.begin(), itend = box.end();
+            it != itend; ++it )
+        if ( rand() % 3 == 0 )
+          {
+            if ( set( *it ) )
+              set.erase( *it );
+            else
+              set.insertNew( *it );
+          }
+      nbRows += voro.update( lower, upper );
+      
+      Voro full( domain, set, metric );
+      for ( typename Domain::ConstIterator it = domain.begin(), itend = domain.end();
+            it != itend; ++it )
+        if ( voro( *it ) != full( *it ) )
+          {
+            trace.error() << "l_" << p << ": edit " << e << ", " << *it << " mapped to "
+                          << voro( *it ) << " instead of " << full( *it ) << std::endl;
+            return false;
+          }
+    }
+  trace.info() << "l_" << p << ": " << nbRows << " rows updated for " << nbEdits
+               << " edits" << std::endl;
+  return true;
+}
+
+bool testIncremental()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock("Incremental Voronoi maps");
+  Z2i::Domain domain2( Z2i::Point( -3, 2 ), Z2i::Point( 40, 30 ) );
+  Z3i::Domain domain3( Z3i::Point( 1, -2, 0 ), Z3i::Point( 20, 36, 18 ) );
+  nbok += ( testIncrementalLp<Z2i::Space, 1>( domain2, 10 )
+            && testIncrementalLp<Z2i::Space, 2>( domain2, 10 )
+            && testIncrementalLp<Z2i::Space, 3>( domain2, 10 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "2D updates give the full maps" << std::endl;
+  nbok += ( testIncrementalLp<Z3i::Space, 1>( domain3, 10 )
+            && testIncrementalLp<Z3i::Space, 2>( domain3, 10 )
+            && testIncrementalLp<Z3i::Space, 3>( domain3, 10 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "3D updates give the full maps" << std::endl;
+
+  // The distance transformation follows its Voronoi map.
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+  typedef DistanceTransformation<Z3i::Space, Z3i::DigitalSet, L2Metric> DT;
+  Z3i::DigitalSet set( domain3 );
+  set.assignFromComplement( Z3i::DigitalSet( domain3 ) );
+  set.erase( Z3i::Point( 5, 5, 5 ) );
+  L2Metric l2;
+  DT dt( domain3, set, l2, true );
+  set.erase( Z3i::Point( 15, 30, 15 ) );
+  dt.update( Z3i::Point( 15, 30, 15 ), Z3i::Point( 15, 30, 15 ) );
+  DT full( domain3, set, l2 );
+  bool ok = dt.isIncremental() && ! full.isIncremental();
+  for ( Z3i::Domain::ConstIterator it = domain3.begin(), itend = domain3.end();
+        it != itend; ++it )
+    ok = ok && ( dt( *it ) == full( *it ) );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "updated distance transformation" << std::endl;
+  // a map built without the incremental flag cannot be updated.
+  ok = false;
+  try
+    {
+      full.update( Z3i::Point( 15, 30, 15 ), Z3i::Point( 15, 30, 15 ) );
+    }
+  catch ( InputException & )
+    {
+      ok = true;
+    }
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "update of a non incremental map" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -566,6 +766,8 @@ int main( int argc, char** argv )
     && testSimple3D() 
     && testSimpleRandom3D()
     && testSimple4D()
+    && testTiles()
+    && testIncremental()
     ; // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
@@ -0,0 +1,163 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageContainerByBricks-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Throughput of ImageContainerByBricks compared to
+ * ImageContainerBySTLVector: scans in the order of the domain and
+ * brick by brick, and distance transformation.
+ *
+ * Usage: testImageContainerByBricks-benchmark [side [cacheSize]]
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByBricks.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint32_t> Vector;
+typedef ImageContainerByBricks<Z3i::Domain, DGtal::uint32_t> Bricks;
+typedef ImageContainerByBricks<Z3i::Domain, Z3i::Vector> VectorBricks;
+typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+
+/**
+ * Ball of radius side/3 minus a few sites: the points of the
+ * predicate are the points of the ball without the sites.
+ */
+struct BallPredicate
+{
+  typedef Z3i::Point Point;
+  BallPredicate( Z3i::Integer side ) : myCenter( Point::diagonal( side / 2 ) ),
+                                       myRadius2( side * side / 9 ) {}
+  bool operator()( const Point & p ) const
+  {
+    Point d = p - myCenter;
+    Z3i::Integer n2 = d[ 0 ] * d[ 0 ] + d[ 1 ] * d[ 1 ] + d[ 2 ] * d[ 2 ];
+    return ( n2 <= myRadius2 ) && ( ( p[ 0 ] + 3 * p[ 1 ] + 7 * p[ 2 ] ) % 997 != 0 );
+  }
+  Point myCenter;
+  Z3i::Integer myRadius2;
+};
+
+/**
+ * Scans of an image: writes in the order of the domain, then sums
+ * the values in the order of the domain and brick by brick.
+ * @return the times in ms.
+ */
+template <typename TImage>
+void scans( TImage & image, const Bricks & bricks,
+            double & tWrite, double & tRead, double & tReadBricks,
+            DGtal::uint64_t & sum )
+{
+  const Z3i::Domain & domain = image.domain();
+  Clock c;
+  c.startClock();
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    image.setValue( *it, (*it)[ 0 ] + (*it)[ 1 ] + (*it)[ 2 ] );
+  tWrite = c.stopClock();
+  c.startClock();
+  sum = 0;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    sum += image( *it );
+  tRead = c.stopClock();
+  c.startClock();
+  DGtal::uint64_t sumBricks = 0;
+  for ( Bricks::Size b = 0; b < bricks.nbBricks(); ++b )
+    {
+      Z3i::Domain brick = bricks.brickDomain( b );
+      for ( Z3i::Domain::ConstIterator it = brick.begin(), itend = brick.end();
+            it != itend; ++it )
+        sumBricks += image( *it );
+    }
+  tReadBricks = c.stopClock();
+  if ( sumBricks != sum )
+    sum = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmark of ImageContainerByBricks" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  Z3i::Integer side = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 128;
+  Bricks::Size cacheSize = ( argc > 2 ) ? atoi( argv[ 2 ] ) : 64;
+  Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( side - 1 ) );
+  double mvoxels = domain.size() / 1e6;
+
+  Vector vector( domain );
+  Bricks bricks( domain, cacheSize );
+  double tWrite[ 2 ], tRead[ 2 ], tReadBricks[ 2 ];
+  DGtal::uint64_t sum[ 2 ];
+  scans( vector, bricks, tWrite[ 0 ], tRead[ 0 ], tReadBricks[ 0 ], sum[ 0 ] );
+  scans( bricks, bricks, tWrite[ 1 ], tRead[ 1 ], tReadBricks[ 1 ], sum[ 1 ] );
+
+  // The Voronoi maps use the default cache size (256 bricks).
+  L2Metric l2;
+  BallPredicate ball( side );
+  Clock c;
+  c.startClock();
+  DistanceTransformation<Z3i::Space, BallPredicate, L2Metric> dt( domain, ball, l2 );
+  double tDT = c.stopClock();
+  c.startClock();
+  DistanceTransformation<Z3i::Space, BallPredicate, L2Metric, VectorBricks>
+    dtBricks( domain, ball, l2 );
+  double tDTBricks = c.stopClock();
+  bool sameDT = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        sameDT && ( it != itend ); ++it )
+    sameDT = ( dt( *it ) == dtBricks( *it ) );
+
+  std::cout << "# side cacheSize container write(Mvox/s) read(Mvox/s) readBricks(Mvox/s) DT(ms)" << std::endl;
+  std::cout << side << " " << cacheSize << " vector "
+            << mvoxels / tWrite[ 0 ] * 1000 << " " << mvoxels / tRead[ 0 ] * 1000 << " "
+            << mvoxels / tReadBricks[ 0 ] * 1000 << " " << tDT << std::endl;
+  std::cout << side << " " << cacheSize << " bricks "
+            << mvoxels / tWrite[ 1 ] * 1000 << " " << mvoxels / tRead[ 1 ] * 1000 << " "
+            << mvoxels / tReadBricks[ 1 ] * 1000 << " " << tDTBricks << std::endl;
+  std::cout << "# bricks mapped: " << bricks.nbLoads() << std::endl;
+
+  bool res = ( sum[ 0 ] != 0 ) && ( sum[ 0 ] == sum[ 1 ] ) && sameDT;
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,272 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageContainerByBricks.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class ImageContainerByBricks.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByBricks.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerByBricks.
+///////////////////////////////////////////////////////////////////////////////
+
+DGtal::uint32_t value( const Z3i::Point & p )
+{
+  return ( p[ 0 ] * 7919 ) ^ ( p[ 1 ] * 104729 ) ^ ( p[ 2 ] * 1299709 );
+}
+
+/**
+ * Point predicate thresholding an image (the foreground predicates
+ * of imagesSetsUtils require a Range::Iterator).
+ */
+template <typename TImage>
+struct ThresholdPredicate
+{
+  typedef typename TImage::Point Point;
+  ThresholdPredicate( const TImage & anImage, typename TImage::Value aValue )
+    : myImage( anImage ), myValue( aValue ) {}
+  bool operator()( const Point & p ) const
+  {
+    return myImage( p ) > myValue;
+  }
+  TImage myImage;
+  typename TImage::Value myValue;
+};
+
+/**
+ * Values written in the order of the domain, read back brick by
+ * brick, with a cache much smaller than the image.
+ */
+bool testBricks()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Values and bricks" );
+
+  typedef ImageContainerByBricks<Z3i::Domain, DGtal::uint32_t, 16> Image;
+  BOOST_CONCEPT_ASSERT(( CImage< Image > ));
+  Z3i::Domain domain( Z3i::Point( -5, 2, -20 ), Z3i::Point( 64, 41, 14 ) );
+  Image image( domain, 4 );
+  trace.info() << image << std::endl;
+
+  nbok += ( image.nbBricks() == 5 * 3 * 3 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") nbBricks=" << image.nbBricks() << std::endl;
+
+  bool zero = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    {
+      zero = zero && ( image( *it ) == 0 );
+      image.setValue( *it, value( *it ) );
+    }
+  nbok += zero ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") new image is zero" << std::endl;
+
+  bool ok = true;
+  Z3i::Domain::Size size = 0;
+  for ( Image::Size b = 0; b < image.nbBricks(); ++b )
+    {
+      Z3i::Domain brick = image.brickDomain( b );
+      size += brick.size();
+      for ( Z3i::Domain::ConstIterator it = brick.begin(), itend = brick.end();
+            it != itend; ++it )
+        ok = ok && domain.isInside( *it ) && ( image.brickIndex( *it ) == b )
+          && ( image( *it ) == value( *it ) );
+    }
+  nbok += ( ok && ( size == domain.size() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") bricks cover the domain, nbLoads="
+               << image.nbLoads() << std::endl;
+
+  // Copies share the values.
+  Image copy( image );
+  copy.setValue( domain.lowerBound(), 12345 );
+  Image::ConstRange r = image.constRange();
+  nbok += ( ( image( domain.lowerBound() ) == 12345 ) && ( *r.begin() == 12345 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") copies share the values" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Named file reopened after the destruction of the image.
+ */
+bool testFile()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Named file" );
+
+  typedef ImageContainerByBricks<Z2i::Domain, double, 8> Image;
+  Z2i::Domain domain( Z2i::Point( 0, 0 ), Z2i::Point( 99, 30 ) );
+  std::string filename = "testImageContainerByBricks.bricks";
+  {
+    Image image( domain, filename, true, 2 );
+    for ( Z2i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+          it != itend; ++it )
+      image.setValue( *it, (*it)[ 0 ] * 0.5 - (*it)[ 1 ] );
+  }
+  Image image( domain, filename, false, 3 );
+  bool ok = true;
+  for ( Z2i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    ok = ok && ( image( *it ) == (*it)[ 0 ] * 0.5 - (*it)[ 1 ] );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") values read back" << std::endl;
+
+  try
+    {
+      Image other( Z2i::Domain( Z2i::Point( 0, 0 ), Z2i::Point( 200, 30 ) ),
+                   filename, false );
+      nb++;
+    }
+  catch ( IOException & )
+    {
+      nbok++;
+      nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") other domain rejected" << std::endl;
+  std::remove( filename.c_str() );
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * VoronoiMap, DistanceTransformation and surface extraction with
+ * bricked images give the same results as with the vector container.
+ */
+bool testAlgorithms()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Voronoi map, distance transformation and surfaces" );
+
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+  typedef ImageContainerByBricks<Z3i::Domain, Z3i::Vector, 4> VectorBricks;
+  typedef VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric> Voro;
+  typedef VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric, VectorBricks> VoroBricks;
+  typedef DistanceTransformation<Z3i::Space, Z3i::DigitalSet, L2Metric> DT;
+  typedef DistanceTransformation<Z3i::Space, Z3i::DigitalSet, L2Metric, VectorBricks> DTBricks;
+
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 37, 29, 33 ) );
+  Z3i::DigitalSet set( domain );
+  srand( 7 );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    if ( rand() % 100 != 0 )
+      set.insertNew( *it );
+  L2Metric l2;
+
+  Voro voro( domain, set, l2 );
+  VoroBricks voroBricks( domain, set, l2 );
+  DT dt( domain, set, l2 );
+  DTBricks dtBricks( domain, set, l2 );
+  bool okVoro = true;
+  bool okDT = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    {
+      okVoro = okVoro && ( voro( *it ) == voroBricks( *it ) );
+      okDT = okDT && ( dt( *it ) == dtBricks( *it ) );
+    }
+  nbok += okVoro ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") same Voronoi map" << std::endl;
+  nbok += okDT ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") same distance transformation" << std::endl;
+
+  // Surfaces of a thresholded bricked image.
+  typedef ImageContainerByBricks<Z3i::Domain, unsigned char, 8> Image;
+  typedef ThresholdPredicate<Image> Predicate;
+  Image image( domain, 6 );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    if ( dt( *it ) > 2.5 )
+      image.setValue( *it, 1 );
+  Predicate predicate( image, 0 );
+  Z3i::KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  SurfelAdjacency<3> sAdj( true );
+  std::vector< std::vector<Z3i::SCell> > components, componentsFromSet;
+  Surfaces<Z3i::KSpace>::extractAllConnectedSCell( components, K, sAdj, predicate );
+  Z3i::DigitalSet inside( domain );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    if ( dt( *it ) > 2.5 )
+      inside.insertNew( *it );
+  Surfaces<Z3i::KSpace>::extractAllConnectedSCell( componentsFromSet, K, sAdj, inside );
+  bool okSurfaces = components.size() == componentsFromSet.size();
+  for ( unsigned int i = 0; okSurfaces && ( i < components.size() ); ++i )
+    okSurfaces = components[ i ].size() == componentsFromSet[ i ].size();
+  nbok += ( okSurfaces && ! components.empty() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") same surfaces ("
+               << components.size() << " components)" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ImageContainerByBricks" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testBricks() && testFile() && testAlgorithms();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
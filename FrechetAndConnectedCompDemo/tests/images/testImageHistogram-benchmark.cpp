@@ -0,0 +1,99 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageHistogram-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Benchmark of ImageHistogram::compute: buffer with sub-histograms
+ * versus the iteration over the points of the domain.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageSelector.h"
+#include "DGtal/images/ImageHistogram.h"
+#include "DGtal/io/readers/PNMReader.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ImageSelector < Z2i::Domain, unsigned char>::Type Image;
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmark of ImageHistogram::compute" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  Image image( Z2i::Domain( Z2i::Point( 0, 0 ), Z2i::Point( 9999, 9999 ) ) );
+  if ( argc > 1 )
+    image = PNMReader<Image>::importPGM( argv[ 1 ] );
+  else
+    {
+      // smooth image: long runs of equal values.
+      srand( 42 );
+      for ( Image::Iterator it = image.begin(); it != image.end(); ++it )
+        *it = (unsigned char) ( ( it - image.begin() ) / 4096 + ( rand() % 4 ) );
+    }
+
+  Clock c;
+  c.startClock();
+  ImageHistogram::Histogram histoDomain( ImageHistogram::nbBins, 0 );
+  for ( Image::Domain::ConstIterator it = image.domain().begin();
+        it != image.domain().end(); ++it )
+    ++histoDomain[ image( *it ) ];
+  double tDomain = c.stopClock();
+  c.startClock();
+  ImageHistogram::Histogram histo;
+  ImageHistogram::compute( image, histo );
+  double tBuffer = c.stopClock();
+  c.startClock();
+  ImageHistogram::Histogram histoThreads;
+  ImageHistogram::compute( image, histoThreads, 4 );
+  double tThreads = c.stopClock();
+  c.startClock();
+  unsigned int t = ImageHistogram::otsuThreshold( histo );
+  std::vector<unsigned int> t3 = ImageHistogram::multiOtsuThresholds( histo, 3 );
+  double tOtsu = c.stopClock();
+
+  std::cout << "# nbPixels domain(ms) buffer(ms) 4threads(ms) otsu+multiotsu3(ms) otsu" << std::endl;
+  std::cout << image.size() << " " << tDomain << " " << tBuffer << " "
+            << tThreads << " " << tOtsu << " " << t << std::endl;
+
+  bool res = ( histo == histoDomain ) && ( histoThreads == histoDomain )
+    && t3.size() == 3;
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,177 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageHistogram.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class ImageHistogram.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageSelector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageHistogram.h"
+#include "DGtal/io/readers/PNMReader.h"
+#include "ConfigTest.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ImageSelector < Z2i::Domain, unsigned char>::Type Image;
+typedef ImageContainerBySTLMap < Z2i::Domain, unsigned char> MapImage;
+
+/**
+ * The between-class variance of the classes given by the thresholds,
+ * computed directly.
+ */
+double betweenClassVariance( const ImageHistogram::Histogram & histo,
+                             const std::vector<unsigned int> & thresholds )
+{
+  double size = 0, sum = 0, v = 0;
+  unsigned int k = 0;
+  double w = 0, m = 0;
+  for ( unsigned int t = 0; t < histo.size(); ++t )
+    {
+      size += histo[ t ];
+      sum += (double) histo[ t ] * t;
+      w += histo[ t ];
+      m += (double) histo[ t ] * t;
+      if ( t + 1 == histo.size() || ( k < thresholds.size() && thresholds[ k ] == t ) )
+        {
+          v += ( w > 0 ) ? m * m / w : 0.0;
+          w = m = 0;
+          ++k;
+        }
+    }
+  return v / size - ( sum / size ) * ( sum / size );
+}
+
+bool testHistogram()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing ImageHistogram::compute ..." );
+  srand( 7 );
+  Image image( Z2i::Domain( Z2i::Point( -3, 2 ), Z2i::Point( 600, 217 ) ) );
+  MapImage map( image.domain() );
+  ImageHistogram::Histogram expected( ImageHistogram::nbBins, 0 );
+  for ( Z2i::Domain::ConstIterator it = image.domain().begin();
+        it != image.domain().end(); ++it )
+    {
+      // runs of equal values and all the values, 255 included.
+      unsigned char v = ( rand() % 3 == 0 ) ? 255 : (unsigned char) ( ( (*it)[ 0 ] / 7 ) % 256 );
+      image.setValue( *it, v );
+      map.setValue( *it, v );
+      ++expected[ v ];
+    }
+  ImageHistogram::Histogram histo, histo4, histoMap;
+  ImageHistogram::compute( image, histo );
+  ImageHistogram::compute( image, histo4, 4 );
+  ImageHistogram::compute( map, histoMap );
+  nbok += ( histo == expected ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") vector image" << std::endl;
+  nbok += ( histo4 == expected ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") 4 threads" << std::endl;
+  nbok += ( histoMap == expected ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") map image" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testOtsu()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing ImageHistogram Otsu thresholds ..." );
+  std::string filename = testPath + "samples/church-small.pgm";
+  Image image = PNMReader<Image>::importPGM( filename );
+  ImageHistogram::Histogram histo;
+  ImageHistogram::compute( image, histo );
+
+  // Otsu: the best of all the thresholds.
+  unsigned int t = ImageHistogram::otsuThreshold( histo );
+  double vMax = -1;
+  unsigned int tMax = 0;
+  for ( unsigned int s = 0; s + 1 < histo.size(); ++s )
+    {
+      double v = betweenClassVariance( histo, std::vector<unsigned int>( 1, s ) );
+      if ( v > vMax + 1e-9 )
+        {
+          vMax = v;
+          tMax = s;
+        }
+    }
+  trace.info() << "otsu=" << t << " brute force=" << tMax << std::endl;
+  nbok += ( std::abs( betweenClassVariance( histo, std::vector<unsigned int>( 1, t ) ) - vMax ) < 1e-6 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") otsu is maximal" << std::endl;
+  std::vector<unsigned int> t1 = ImageHistogram::multiOtsuThresholds( histo, 1 );
+  nbok += ( t1.size() == 1 && t1[ 0 ] == t ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") multi otsu with 1 threshold" << std::endl;
+
+  // two thresholds: all the pairs.
+  std::vector<unsigned int> t2 = ImageHistogram::multiOtsuThresholds( histo, 2 );
+  std::vector<unsigned int> pair( 2 );
+  vMax = -1;
+  for ( pair[ 0 ] = 0; pair[ 0 ] + 2 < histo.size(); ++pair[ 0 ] )
+    for ( pair[ 1 ] = pair[ 0 ] + 1; pair[ 1 ] + 1 < histo.size(); ++pair[ 1 ] )
+      vMax = std::max( vMax, betweenClassVariance( histo, pair ) );
+  trace.info() << "multi otsu=" << t2[ 0 ] << "," << t2[ 1 ] << std::endl;
+  nbok += ( t2[ 0 ] < t2[ 1 ]
+            && std::abs( betweenClassVariance( histo, t2 ) - vMax ) < 1e-6 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") multi otsu with 2 thresholds" << std::endl;
+  std::vector<unsigned int> t3 = ImageHistogram::multiOtsuThresholds( histo, 3 );
+  nbok += ( t3[ 0 ] < t3[ 1 ] && t3[ 1 ] < t3[ 2 ]
+            && betweenClassVariance( histo, t3 ) >= vMax - 1e-6 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") multi otsu with 3 thresholds" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ImageHistogram" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testHistogram() && testOtsu();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,148 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBinaryContourReader.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing classes BinaryContourReader and
+ * BinaryContourWriter.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <fstream>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/io/readers/PointListReader.h"
+#include "DGtal/io/readers/BinaryContourReader.h"
+#include "DGtal/io/writers/BinaryContourWriter.h"
+
+#include "ConfigTest.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class BinaryContourReader.
+///////////////////////////////////////////////////////////////////////////////
+
+bool testBinaryContourReader()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing writing and reading contours ..." );
+  std::vector< std::vector<Z2i::Point> > contours( 4 );
+  // a 4-connected contour, Freeman coded.
+  Z2i::Point p( -3, 7 );
+  for ( unsigned int i = 0; i < 1001; ++i )
+    {
+      contours[ 0 ].push_back( p );
+      p[ rand() % 2 ] += ( rand() % 2 ) ? 1 : -1;
+    }
+  // a polygon, written as is.
+  contours[ 1 ].push_back( Z2i::Point( 0, 0 ) );
+  contours[ 1 ].push_back( Z2i::Point( 100000, -3 ) );
+  contours[ 1 ].push_back( Z2i::Point( -7, 1 ) );
+  // an empty contour and a single point.
+  contours[ 3 ].push_back( Z2i::Point( 5, 5 ) );
+  std::string filename = "testBinaryContourReader.bin";
+  nbok += BinaryContourWriter<Z2i::Point>::exportContours( filename, contours ) ? 1 : 0;
+  nb++;
+  BinaryContourReader<Z2i::Point> reader( filename );
+  trace.info() << reader << std::endl;
+  nbok += reader.isValid() && ( reader.size() == 4 ) ? 1 : 0;
+  nb++;
+  std::vector< std::vector<Z2i::Point> > contours2 = 
+    BinaryContourReader<Z2i::Point>::getPolygonsFromFile( filename );
+  nbok += ( contours2 == contours ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "contours read == contours written" << std::endl;
+  std::ifstream in( filename.c_str(), std::ios_base::binary | std::ios_base::ate );
+  trace.info() << "file size: " << in.tellg() << " bytes" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Testing the contours of sdp files ..." );
+  std::vector< std::vector<Z2i::Point> > polygons;
+  polygons.push_back( PointListReader<Z2i::Point>::getPointsFromFile( testPath + "samples/france.sdp" ) );
+  polygons.push_back( PointListReader<Z2i::Point>::getPointsFromFile( testPath + "samples/klokan.sdp" ) );
+  nbok += BinaryContourWriter<Z2i::Point>::exportContours( filename, polygons, false ) ? 1 : 0;
+  nb++;
+  nbok += ( BinaryContourReader<Z2i::Point>::getPolygonsFromFile( filename ) == polygons ) ? 1 : 0;
+  nb++;
+  nbok += BinaryContourReader<Z2i::Point>::isBinaryContourFile( filename )
+    && ! BinaryContourReader<Z2i::Point>::isBinaryContourFile( testPath + "samples/france.sdp" ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "sdp files read back" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Testing a truncated file ..." );
+  std::ofstream out( filename.c_str(), std::ios_base::binary );
+  BinaryContourWriter<Z2i::Point>::exportContours( out, contours );
+  out.close();
+  std::ifstream in2( filename.c_str(), std::ios_base::binary );
+  std::vector<char> data( 100 );
+  in2.read( &data[ 0 ], data.size() );
+  in2.close();
+  out.open( filename.c_str(), std::ios_base::binary );
+  out.write( &data[ 0 ], data.size() );
+  out.close();
+  bool thrown = false;
+  try
+    {
+      BinaryContourReader<Z2i::Point> r( filename );
+    }
+  catch ( IOException & )
+    {
+      thrown = true;
+    }
+  nbok += thrown ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "IOException on a truncated file" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class BinaryContourReader" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testBinaryContourReader();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
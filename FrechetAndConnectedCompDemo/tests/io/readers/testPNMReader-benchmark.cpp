@@ -0,0 +1,162 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPNMReader-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Benchmark of PNMReader::importPGM: memory-mapped file and bulk row
+ * copies versus the reading of the pixels one by one with an istream.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <cstdio>
+#include <vector>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageSelector.h"
+#include "DGtal/io/readers/PNMReader.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ImageSelector < Z2i::Domain, unsigned char>::Type Image;
+
+/**
+ * PNMReader::importPGM the way it was before the memory mapping: the
+ * pixels are read one by one with operator>> and set with setValue.
+ */
+Image importPGMByStream( const std::string & aFilename )
+{
+  std::ifstream infile( aFilename.c_str(), std::ifstream::in );
+  std::string str;
+  getline( infile, str );
+  bool isASCIImode = ( str == "P2" );
+  do
+    getline( infile, str );
+  while ( str[ 0 ] == '#' || str=="");
+  std::istringstream str_in( str );
+  unsigned int w, h;
+  str_in >> w >> h;
+  Image image( Z2i::Domain( Z2i::Point( 0, 0 ), Z2i::Point( w-1, h-1 ) ) );
+  getline( infile, str );
+  if(!isASCIImode)
+    infile >> std::noskipws;
+  for(unsigned int y=0; y <h; y++)
+    for(unsigned int x=0; x <w; x++)
+      {
+        Z2i::Point pt( x, h-1-y );
+        if(!isASCIImode)
+          {
+            unsigned char c;
+            infile >> c;
+            image.setValue( pt, c );
+          }
+        else
+          {
+            int c;
+            infile >> c;
+            image.setValue( pt, c );
+          }
+      }
+  return image;
+}
+
+/**
+ * Writes a w x h PGM file of pseudo-random values.
+ */
+void writePGM( const std::string & aFilename, unsigned int w, unsigned int h,
+               bool ascii )
+{
+  std::ofstream out( aFilename.c_str(), std::ios::binary );
+  out << ( ascii ? "P2" : "P5" ) << "\n# benchmark\n" << w << " " << h << "\n255\n";
+  std::vector<char> row( w );
+  srand( 42 );
+  for ( unsigned int y = 0; y < h; ++y )
+    {
+      for ( unsigned int x = 0; x < w; ++x )
+        row[ x ] = (char) ( ( x ^ y ) + ( rand() % 16 ) );
+      if ( ascii )
+        {
+          for ( unsigned int x = 0; x < w; ++x )
+            out << (unsigned int) (unsigned char) row[ x ] << ( x+1 == w ? "\n" : " " );
+        }
+      else
+        out.write( &row[ 0 ], w );
+    }
+}
+
+/**
+ * Times both readers on a file.
+ * @return 'true' if they give the same image.
+ */
+bool bench( const std::string & aFilename )
+{
+  Clock c;
+  c.startClock();
+  Image image1 = importPGMByStream( aFilename );
+  double tStream = c.stopClock();
+  c.startClock();
+  Image image2 = PNMReader<Image>::importPGM( aFilename );
+  double tMapped = c.stopClock();
+  std::cout << aFilename << " " << image2.domain().size() << " "
+            << tStream << " " << tMapped << std::endl;
+  return ( image1.domain().upperBound() == image2.domain().upperBound() )
+    && std::equal( image1.begin(), image1.end(), image2.begin() );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmark of PNMReader::importPGM" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = true;
+  std::cout << "# file nbPixels stream(ms) mapped(ms)" << std::endl;
+  if ( argc > 1 )
+    res = bench( argv[ 1 ] );
+  else
+    {
+      writePGM( "testPNMReader-benchmark-P5.pgm", 10000, 10000, false );
+      writePGM( "testPNMReader-benchmark-P2.pgm", 2000, 2000, true );
+      res = bench( "testPNMReader-benchmark-P5.pgm" )
+        && bench( "testPNMReader-benchmark-P2.pgm" );
+      std::remove( "testPNMReader-benchmark-P5.pgm" );
+      std::remove( "testPNMReader-benchmark-P2.pgm" );
+    }
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
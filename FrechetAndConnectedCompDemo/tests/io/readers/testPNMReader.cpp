@@ -29,11 +29,13 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <fstream>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/io/boards/Board2D.h"
 #include "DGtal/io/readers/PNMReader.h"
 #include "DGtal/images/ImageSelector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
 #include "DGtal/images/imagesSetsUtils/SetFromImage.h"
 #include "ConfigTest.h"
 
@@ -101,6 +103,67 @@ bool testPNM3DReader()
   return nbok == nb;
 }
 
+/**
+ * Reads the same image written in raw (P5) and ASCII (P2) modes, into
+ * images stored in a vector and in a map.
+ */
+bool testPGMRawAndASCII()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;  
+  trace.beginBlock ( "Testing pgm reader P5/P2 ..." );
+  const unsigned int w = 7, h = 5;
+  unsigned char values[ w*h ];
+  for ( unsigned int i = 0; i < w*h; ++i )
+    values[ i ] = (unsigned char) ( ( 37 * i ) % 256 );
+  {
+    std::ofstream out( "testPNMReader-P5.pgm", std::ios::binary );
+    out << "P5\n# comment\n" << w << " " << h << "\n255\n";
+    out.write( (const char*) values, w*h );
+    std::ofstream outASCII( "testPNMReader-P2.pgm" );
+    outASCII << "P2\n" << w << " " << h << "\n# comment\n255\n";
+    for ( unsigned int i = 0; i < w*h; ++i )
+      outASCII << (unsigned int) values[ i ] << ( ( i % w == w-1 ) ? "\n" : "  " );
+    std::ofstream outTruncated( "testPNMReader-truncated.pgm", std::ios::binary );
+    outTruncated << "P5\n" << w << " " << h << "\n255\n";
+    outTruncated.write( (const char*) values, w*h - 3 );
+  }
+  typedef ImageSelector < Z2i::Domain, unsigned char>::Type Image;
+  typedef ImageContainerBySTLMap < Z2i::Domain, int> MapImage;
+  Image raw = PNMReader<Image>::importPGM( "testPNMReader-P5.pgm" );
+  Image ascii = PNMReader<Image>::importPGM( "testPNMReader-P2.pgm" );
+  MapImage map = PNMReader<MapImage>::importPGM( "testPNMReader-P5.pgm" );
+  Image topDown = PNMReader<Image>::importPGM( "testPNMReader-P5.pgm", false );
+  bool same = ( raw.domain().upperBound() == Z2i::Point( w-1, h-1 ) );
+  for ( unsigned int y = 0; y < h; ++y )
+    for ( unsigned int x = 0; x < w; ++x )
+      {
+        Z2i::Point p( x, h-1-y );
+        unsigned char v = values[ y*w + x ];
+        same = same && raw( p ) == v && ascii( p ) == v && map( p ) == v
+          && topDown( Z2i::Point( x, y ) ) == v;
+      }
+  nbok += same ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "P5 == P2 == file values" << std::endl;
+  bool thrown = false;
+  try
+    {
+      PNMReader<Image>::importPGM( "testPNMReader-truncated.pgm" );
+    }
+  catch( IOException & )
+    {
+      thrown = true;
+    }
+  nbok += thrown ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "truncated file throws IOException" << std::endl;
+  trace.endBlock();  
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -112,7 +175,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testPNMReader() && testPNM3DReader(); // && ... other tests
+  bool res = testPNMReader() && testPGMRawAndASCII() && testPNM3DReader(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
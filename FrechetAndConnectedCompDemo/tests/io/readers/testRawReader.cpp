@@ -36,6 +36,8 @@
 #include "DGtal/images/ImageSelector.h"
 #include "DGtal/io/writers/PGMWriter.h"
 #include "DGtal/io/readers/RawReader.h"
+#include "DGtal/io/writers/RawWriter.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
 
 #include "ConfigTest.h"
 
@@ -89,6 +91,73 @@ bool testRawReader2D()
   return nbok == nb;
 }
 
+bool testRawRoundTrips3D()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing Raw export and import, 8 and 16 bits ..." );
+  
+  typedef SpaceND<3> Space3;
+  typedef HyperRectDomain<Space3> TDomain;
+  typedef TDomain::Point Point;
+  typedef TDomain::Vector Vector;
+  typedef ImageSelector<TDomain, unsigned char>::Type Image;
+  typedef ImageContainerBySTLVector<TDomain, DGtal::uint16_t> Image16;
+  typedef ImageContainerBySTLMap<TDomain, DGtal::uint16_t> MapImage16;
+
+  Vector ext( 17, 5, 3 );
+  TDomain domain( Point( 0, 0, 0 ), ext - Point::diagonal( 1 ) );
+  Image image( domain );
+  Image16 image16( domain );
+  // the values of an image which is not a vector go through a buffer.
+  MapImage16 map16( domain );
+  unsigned int i = 0;
+  for ( TDomain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it, ++i )
+    {
+      image[ i ] = ( 7 * i ) % 256;
+      image16[ i ] = ( 1031 * i ) % 65536;
+      map16.setValue( *it, image16[ i ] );
+    }
+  RawWriter<Image>::exportRaw8( "export-raw8.raw", image );
+  RawWriter<MapImage16>::exportRaw16( "export-raw16.raw", map16 );
+
+  Image image8Read = RawReader<Image>::importRaw8( "export-raw8.raw", ext );
+  Image16 image16Read = RawReader<Image16>::importRaw16( "export-raw16.raw", ext );
+  bool ok8 = true, ok16 = true;
+  for ( TDomain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    {
+      ok8 = ok8 && ( image( *it ) == image8Read( *it ) );
+      ok16 = ok16 && ( image16( *it ) == image16Read( *it ) );
+    }
+  nbok += ok8 ? 1 : 0; 
+  nb++;
+  nbok += ok16 ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same values after export and import" << std::endl;
+
+  // the 8 bits file is too short for 16 bits values.
+  bool thrown = false;
+  try
+    {
+      RawReader<Image16>::importRaw16( "export-raw8.raw", ext );
+    }
+  catch ( IOException & )
+    {
+      thrown = true;
+    }
+  nbok += thrown ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "file too short" << std::endl;
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -100,7 +169,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testRawReader2D(); // && ... other tests
+  bool res = testRawReader2D() && testRawRoundTrips3D(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
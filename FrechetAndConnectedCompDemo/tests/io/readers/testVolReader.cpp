@@ -39,6 +39,8 @@
 #include "DGtal/io/colormaps/GradientColorMap.h"
 #include "DGtal/io/colormaps/ColorBrightnessColorMap.h"
 #include "DGtal/io/writers/VolWriter.h"
+#include <cstdlib>
+#include <fstream>
 
 #include "ConfigTest.h"
 
@@ -138,6 +140,100 @@ bool testIOException()
   return nbok == nb;
 }
 
+/**
+ * Compares the values of two images on the domain of the first one.
+ */
+template <typename TImage1, typename TImage2>
+bool sameValues( const TImage1 & image1, const TImage2 & image2 )
+{
+  if ( ( image1.domain().lowerBound() != image2.domain().lowerBound() )
+       || ( image1.domain().upperBound() != image2.domain().upperBound() ) )
+    return false;
+  for ( typename TImage1::Domain::ConstIterator it = image1.domain().begin(),
+          itend = image1.domain().end(); it != itend; ++it )
+    if ( image1( *it ) != image2( *it ) )
+      return false;
+  return true;
+}
+
+bool testVolRoundTrips()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing Vol export and import, 8 and 16 bits, compressed or not ..." );
+
+  typedef SpaceND<3> Space;
+  typedef HyperRectDomain<Space> TDomain;
+  typedef TDomain::Point Point;
+  typedef ImageSelector<TDomain, unsigned char>::Type Image;
+  typedef ImageContainerBySTLVector<TDomain, DGtal::uint16_t> Image16;
+  
+  Image image = VolReader<Image>::importVol( testPath + "samples/cat10.vol" );
+  VolWriter<Image>::exportVol( "cat10-export.vol", image );
+  VolWriter<Image>::exportVol( "cat10-export-rle.vol", image, DefaultFunctor(), true );
+  nbok += sameValues( image, VolReader<Image>::importVol( "cat10-export.vol" ) ) ? 1 : 0; 
+  nb++;
+  nbok += sameValues( image, VolReader<Image>::importVol( "cat10-export-rle.vol" ) ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "8 bits round trips" << std::endl;
+
+  // 16 bits values, with runs and noise.
+  Image16 image16( TDomain( Point( 0, 0, 0 ), Point( 300, 7, 5 ) ) );
+  srand( 0 );
+  for ( unsigned int i = 0; i < image16.size(); ++i )
+    image16[ i ] = ( i % 301 < 150 ) ? ( i / 301 ) * 1000 : rand() % 65536;
+  VolWriter<Image16>::exportVol16( "export16.vol", image16 );
+  VolWriter<Image16>::exportVol16( "export16-rle.vol", image16, DefaultFunctor(), true );
+  nbok += sameValues( image16, VolReader<Image16>::importVol( "export16.vol" ) ) ? 1 : 0; 
+  nb++;
+  nbok += sameValues( image16, VolReader<Image16>::importVol( "export16-rle.vol" ) ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "16 bits round trips" << std::endl;
+
+  // a truncated file is an error.
+  std::ifstream in( "export16-rle.vol", std::ios_base::binary );
+  std::string content( ( std::istreambuf_iterator<char>( in ) ),
+                       std::istreambuf_iterator<char>() );
+  in.close();
+  std::ofstream out( "export16-truncated.vol", std::ios_base::binary );
+  out.write( content.data(), content.size() - 10 );
+  out.close();
+  bool thrown = false;
+  try
+    {
+      VolReader<Image16>::importVol( "export16-truncated.vol" );
+    }
+  catch ( IOException & )
+    {
+      thrown = true;
+    }
+  nbok += thrown ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "truncated file" << std::endl;
+
+  // 16 bits voxels do not fit in unsigned char values.
+  thrown = false;
+  try
+    {
+      VolReader<Image>::importVol( "export16.vol" );
+    }
+  catch ( IOException & )
+    {
+      thrown = true;
+    }
+  nbok += thrown ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "16 bits voxels in an 8 bits image" << std::endl;
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -149,7 +245,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testVolReader() && testIOException(); // && ... other tests
+  bool res = testVolReader() && testIOException() && testVolRoundTrips(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
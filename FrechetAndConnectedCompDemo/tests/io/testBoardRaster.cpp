@@ -0,0 +1,252 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBoardRaster.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing the raster output of Board (LibBoard::Raster).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "DGtal/io/boards/Board2D.h"
+#include "Board/Raster.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing the raster output of Board.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return the number of pixels of the given color.
+ */
+unsigned int count( const LibBoard::Raster & raster, const Color & color )
+{
+  unsigned int n = 0;
+  for ( unsigned int y = 0; y < raster.height(); ++y )
+    for ( unsigned int x = 0; x < raster.width(); ++x )
+      if ( raster.pixel( x, y ) == color ) ++n;
+  return n;
+}
+
+std::vector<LibBoard::Point> rectangle( double x0, double y0, double x1, double y1 )
+{
+  std::vector<LibBoard::Point> points;
+  points.push_back( LibBoard::Point( x0, y0 ) );
+  points.push_back( LibBoard::Point( x1, y0 ) );
+  points.push_back( LibBoard::Point( x1, y1 ) );
+  points.push_back( LibBoard::Point( x0, y1 ) );
+  return points;
+}
+
+/**
+ * Fills with and without antialiasing.
+ */
+bool testFill()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Filling polygons" );
+  LibBoard::Raster raster( false );
+  raster.init( 20, 10, Color::None );
+  nbok += ( count( raster, Color::White ) == 200 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "white background" << std::endl;
+
+  raster.fillPolygon( rectangle( 2, 2, 8, 6 ), Color::Red );
+  raster.render();
+  nbok += ( count( raster, Color::Red ) == 24
+            && raster.pixel( 2, 2 ) == Color::Red && raster.pixel( 7, 5 ) == Color::Red
+            && raster.pixel( 8, 2 ) == Color::White && raster.pixel( 2, 6 ) == Color::White ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "the centers of 6x4 pixels are inside" << std::endl;
+
+  // Half of the pixels of columns 2 and 7 are covered.
+  LibBoard::Raster antialiased( true );
+  antialiased.init( 20, 10, Color::White );
+  antialiased.fillPolygon( rectangle( 2.5, 2, 7.5, 6 ), Color::Red );
+  antialiased.render();
+  Color half = antialiased.pixel( 2, 3 );
+  nbok += ( count( antialiased, Color::Red ) == 16 && antialiased.pixel( 7, 5 ) == half
+            && half.red() == 255 && std::abs( (int) half.green() - 128 ) <= 1 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "antialiased boundary pixels " << half << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Caps, and strokes painted once where their pieces overlap.
+ */
+bool testStroke()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Stroking lines" );
+  std::vector<LibBoard::Point> line;
+  line.push_back( LibBoard::Point( 5, 10 ) );
+  line.push_back( LibBoard::Point( 25, 10 ) );
+  LibBoard::Raster raster( false );
+  raster.init( 40, 20, Color::None );
+  raster.strokePolyline( line, false, 4.0, LibBoard::Shape::ButtCap,
+                         LibBoard::Shape::MiterJoin, Color::Blue );
+  raster.render();
+  nbok += ( count( raster, Color::Blue ) == 80 && raster.pixel( 5, 8 ) == Color::Blue
+            && raster.pixel( 24, 11 ) == Color::Blue && raster.pixel( 4, 10 ) == Color::White
+            && raster.pixel( 10, 12 ) == Color::White ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "butt cap" << std::endl;
+
+  raster.init( 40, 20, Color::None );
+  raster.strokePolyline( line, false, 4.0, LibBoard::Shape::SquareCap,
+                         LibBoard::Shape::MiterJoin, Color::Blue );
+  raster.render();
+  nbok += ( count( raster, Color::Blue ) == 96 && raster.pixel( 3, 10 ) == Color::Blue
+            && raster.pixel( 2, 10 ) == Color::White ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "square cap" << std::endl;
+
+  raster.init( 40, 20, Color::None );
+  raster.strokePolyline( line, false, 4.0, LibBoard::Shape::RoundCap,
+                         LibBoard::Shape::RoundJoin, Color::Blue );
+  raster.render();
+  nbok += ( raster.pixel( 3, 10 ) == Color::Blue && raster.pixel( 3, 8 ) == Color::White ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "round cap" << std::endl;
+
+  // A transparent closed square: corners, joins and sides overlap.
+  Color transparent( 0, 0, 255, 128 );
+  LibBoard::Raster antialiased( true );
+  antialiased.init( 40, 40, Color::None );
+  antialiased.strokePolyline( rectangle( 10, 10, 30, 30 ), true, 4.0, LibBoard::Shape::ButtCap,
+                              LibBoard::Shape::MiterJoin, transparent );
+  antialiased.render();
+  Color side = antialiased.pixel( 20, 10 );
+  nbok += ( side != Color::White && antialiased.pixel( 10, 10 ) == side
+            && antialiased.pixel( 8, 8 ) == side && antialiased.pixel( 31, 31 ) == side
+            && antialiased.pixel( 20, 20 ) == Color::White ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "overlapping pieces painted once " << side << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Draws a board, with several threads, and in PNG and PPM files.
+ */
+bool testBoard()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Rasterizing a board" );
+  Board2D board;
+  board.setPenColor( Color::Blue );
+  board.setFillColor( Color::None );
+  board.setLineWidth( 2 );
+  std::vector<LibBoard::Point> points;
+  for ( unsigned int i = 0; i < 200; ++i )
+    points.push_back( LibBoard::Point( 100 + 80 * cos( i * 0.05 ) + i * 0.3,
+                                       100 + 60 * sin( i * 0.065 ) ) );
+  board.drawPolyline( points );
+  board.setPenColor( Color::Red );
+  board.setFillColor( Color( 0, 200, 0 ) );
+  board.setLineWidth( 1 );
+  board.drawRectangle( 20, 180, 40, 30 );
+  board.fillCircle( 150, 150, 20 );
+  board.drawArrow( 30, 100, 90, 60, true );
+  board.setLineWidth( 0.0 );
+  board.setFillColor( Color::None );
+  board.drawRectangle( 0, 200, 200, 200 );
+
+  LibBoard::Raster single( true, 1 );
+  board.rasterize( single, 200, 200, 10.0, 72.0 );
+  LibBoard::Raster tiled( true, 4 );
+  board.rasterize( tiled, 200, 200, 10.0, 72.0 );
+  bool same = single.width() == tiled.width() && single.height() == tiled.height();
+  for ( unsigned int y = 0; same && y < single.height(); ++y )
+    for ( unsigned int x = 0; same && x < single.width(); ++x )
+      same = single.pixel( x, y ) == tiled.pixel( x, y );
+  nbok += ( same && single.width() > 0 && count( single, Color::Red ) > 0
+            && count( single, Color( 0, 200, 0 ) ) > 0 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same " << single.width() << "x" << single.height()
+               << " image with 1 and 4 threads" << std::endl;
+
+  board.saveRaster( "boardraster.ppm", LibBoard::Board::RasterPPM, 200, 200 );
+  std::ifstream ppm( "boardraster.ppm", std::ios::binary );
+  std::string magic;
+  unsigned int width = 0, height = 0, maxValue = 0;
+  ppm >> magic >> width >> height >> maxValue;
+  ppm.get();
+  std::vector<char> data( 3 * width * height );
+  ppm.read( &data[ 0 ], data.size() );
+  nbok += ( magic == "P6" && width == single.width() && height == single.height()
+            && maxValue == 255 && ppm.gcount() == (std::streamsize) data.size()
+            && (unsigned char) data[ 0 ] == single.pixel( 0, 0 ).red() ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "PPM file " << width << "x" << height << std::endl;
+
+  board.save( "boardraster.png", 200, 200 );
+  std::ifstream png( "boardraster.png", std::ios::binary );
+  unsigned char header[ 24 ];
+  png.read( (char *) header, 24 );
+  const unsigned char signature[ 8 ] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+  unsigned int pngWidth = ( header[ 16 ] << 24 ) | ( header[ 17 ] << 16 ) | ( header[ 18 ] << 8 ) | header[ 19 ];
+  nbok += ( png.gcount() == 24 && std::equal( signature, signature + 8, header )
+            && std::string( (char *) header + 12, 4 ) == "IHDR" && pngWidth == single.width() ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "PNG file" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing the raster output of Board" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testFill() && testStroke() && testBoard(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
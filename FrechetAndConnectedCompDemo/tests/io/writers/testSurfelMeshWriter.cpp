@@ -0,0 +1,191 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSurfelMeshWriter.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class SurfelMeshWriter.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <map>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageSelector.h"
+#include "DGtal/io/colormaps/GradientColorMap.h"
+#include "DGtal/io/writers/SurfelMeshWriter.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+typedef ImageSelector<Domain, int>::Type Image;
+typedef IntervalThresholder<Image::Value> Binarizer;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SurfelMeshWriter.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Reads back an OFF file written by SurfelMeshWriter.
+ * @return 'true' if each oriented edge is used by exactly one face
+ * and its opposite edge by another one (closed oriented surfaces).
+ */
+bool isClosedOrientedOFF( const char* aFilename,
+                          unsigned int & nbVertices, unsigned int & nbFaces )
+{
+  ifstream in( aFilename );
+  string line;
+  getline( in, line );
+  if ( line != "OFF" ) return false;
+  getline( in, line );
+  unsigned int zero;
+  in >> nbVertices >> nbFaces >> zero;
+  for ( unsigned int i = 0; i < 3 * nbVertices; ++i )
+    {
+      double x;
+      in >> x;
+    }
+  map< pair<unsigned int, unsigned int>, unsigned int > edges;
+  for ( unsigned int i = 0; i < nbFaces; ++i )
+    {
+      unsigned int n, v[ 4 ];
+      double color[ 4 ];
+      in >> n >> v[ 0 ] >> v[ 1 ] >> v[ 2 ] >> v[ 3 ]
+         >> color[ 0 ] >> color[ 1 ] >> color[ 2 ] >> color[ 3 ];
+      if ( n != 4 ) return false;
+      for ( unsigned int j = 0; j < 4; ++j )
+        edges[ make_pair( v[ j ], v[ ( j + 1 ) % 4 ] ) ]++;
+    }
+  if ( ! in.good() ) return false;
+  for ( map< pair<unsigned int, unsigned int>, unsigned int >::const_iterator
+          it = edges.begin(); it != edges.end(); ++it )
+    {
+      map< pair<unsigned int, unsigned int>, unsigned int >::const_iterator
+        opp = edges.find( make_pair( it->first.second, it->first.first ) );
+      if ( it->second != 1 || opp == edges.end() || opp->second != 1 )
+        return false;
+    }
+  return true;
+}
+
+/**
+ * Exports the boundaries of two balls, one of them with a cavity.
+ */
+bool testSurfelMeshWriter()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing SurfelMeshWriter ..." );
+  Domain domain( Point( -10, -10, -10 ), Point( 10, 10, 10 ) );
+  Image image( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    {
+      Point p = *it;
+      double r1 = ( p - Point( -4, 0, 0 ) ).norm();
+      double r2 = ( p - Point( 5, 0, 0 ) ).norm();
+      image.setValue( p, ( ( r1 < 5 && r1 >= 2 ) || r2 < 4 ) ? 200 : 0 );
+    }
+  Binarizer b( 128, 255 );
+  PointFunctorPredicate<Image, Binarizer> predicate( image, b );
+  KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  SurfelAdjacency<3> sAdj( true );
+
+  SurfelMeshWriter<KSpace> writer( K );
+  Surfaces<KSpace>::extractAllConnectedSCell( writer.inserter(), K, sAdj,
+                                              predicate, false );
+  trace.info() << writer << endl;
+  std::vector< std::vector<SCell> > vectConnectedSCell;
+  Surfaces<KSpace>::extractAllConnectedSCell( vectConnectedSCell, K, sAdj,
+                                              predicate, false );
+  DGtal::uint64_t nbSurfels = 0;
+  for ( unsigned int i = 0; i < vectConnectedSCell.size(); ++i )
+    nbSurfels += vectConnectedSCell[ i ].size();
+  nbok += ( writer.nbComponents() == 3 && vectConnectedSCell.size() == 3 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "three components" << std::endl;
+  nbok += ( writer.nbFaces() == nbSurfels ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "one face per surfel" << std::endl;
+  // Three spheres: V - E + F = 2 for each, with E = 2F.
+  nbok += ( writer.nbVertices() == writer.nbFaces() + 6 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "shared vertices, V = F + 6" << std::endl;
+
+  GradientColorMap<long> gradient( 0, writer.nbComponents() );
+  gradient.addColor( Color::Red );
+  gradient.addColor( Color::Blue );
+  unsigned int nbVertices, nbFaces;
+  nbok += ( writer.exportMesh( "testSurfelMeshWriter.off", gradient )
+            && isClosedOrientedOFF( "testSurfelMeshWriter.off", nbVertices, nbFaces )
+            && nbVertices == writer.nbVertices() && nbFaces == writer.nbFaces() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "OFF export of closed oriented surfaces" << std::endl;
+
+  nbok += writer.exportMesh( "testSurfelMeshWriter.ply", gradient ) ? 1 : 0;
+  nb++;
+  ifstream in( "testSurfelMeshWriter.ply", ios_base::binary );
+  string line;
+  unsigned int headerSize = 0;
+  while ( getline( in, line ) && line != "end_header" )
+    headerSize += line.size() + 1;
+  headerSize += line.size() + 1;
+  in.seekg( 0, ios_base::end );
+  DGtal::uint64_t size = in.tellg();
+  nbok += ( line == "end_header"
+            && size == headerSize + 12 * writer.nbVertices() + 21 * writer.nbFaces() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "binary PLY export of " << size << " bytes" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class SurfelMeshWriter" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testSurfelMeshWriter();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
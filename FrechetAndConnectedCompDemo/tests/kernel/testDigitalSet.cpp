@@ -51,6 +51,7 @@
 #include "DGtal/kernel/domains/CDomainArchetype.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/kernel/sets/DigitalSetByBitGrid.h"
 #include "DGtal/kernel/sets/DigitalSetFromMap.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
 #include "DGtal/kernel/sets/DigitalSetDomain.h"
@@ -347,6 +348,93 @@ bool testDigitalSetDomain()
   return nbok == nb;
 }
 
+/**
+ * Compares DigitalSetByBitGrid to DigitalSetBySTLSet on random sets
+ * of a 3D domain whose size is not a multiple of 64.
+ */
+bool testDigitalSetByBitGrid()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef Z3i::Domain Domain;
+  typedef Z3i::Point Point;
+  typedef DigitalSetByBitGrid<Domain> BitSet;
+  typedef DigitalSetBySTLSet<Domain> STLSet;
+  BOOST_CONCEPT_ASSERT(( CDigitalSet< BitSet > ));
+  BOOST_STATIC_ASSERT(( boost::is_same< Z3i::BitGridDigitalSet, BitSet >::value ));
+  BOOST_STATIC_ASSERT(( boost::is_same< Z3i::DigitalSet, STLSet >::value ));
+  BOOST_STATIC_ASSERT(( boost::is_same< DigitalSetSelector< Domain, SMALL_DS + HIGH_BEL_DS >::Type,
+                        STLSet >::value ));
+
+  trace.beginBlock ( "DigitalSetByBitGrid versus DigitalSetBySTLSet" );
+  Domain domain( Point( -3, 2, -5 ), Point( 9, 8, 1 ) );
+  BitSet a( domain ), b( domain );
+  STLSet sa( domain ), sb( domain );
+  srand( 0 );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    {
+      if ( rand() % 3 == 0 ) { a.insert( *it ); sa.insert( *it ); }
+      if ( rand() % 2 == 0 ) { b.insertNew( *it ); sb.insertNew( *it ); }
+    }
+  INBLOCK_TEST( a.size() == sa.size() && b.size() == sb.size() && a.isValid() );
+  // points are visited in the order of the domain.
+  std::vector<Point> va( a.begin(), a.end() );
+  std::vector<Point> vd;
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( sa( *it ) ) vd.push_back( *it );
+  INBLOCK_TEST( va == vd );
+  std::vector<Point> vr;
+  for ( BitSet::ConstIterator it = a.end(); it != a.begin(); )
+    vr.push_back( *--it );
+  std::reverse( vr.begin(), vr.end() );
+  INBLOCK_TEST( vr == vd );
+
+  BitSet u( a ), i( a ), d( a ), c( domain );
+  STLSet su( sa ), si( domain ), sd( domain ), sc( domain );
+  u += b;
+  su += sb;
+  i *= b;
+  d -= b;
+  c.assignFromComplement( a );
+  for ( STLSet::ConstIterator it = sa.begin(); it != sa.end(); ++it )
+    {
+      if ( sb( *it ) ) si.insert( *it );
+      else sd.insert( *it );
+    }
+  sc.assignFromComplement( sa );
+  INBLOCK_TEST( u.size() == su.size() && u.isValid() );
+  unsigned int nbDiff = 0;
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    nbDiff += ( u( *it ) != su( *it ) ) + ( i( *it ) != si( *it ) )
+      + ( d( *it ) != sd( *it ) ) + ( c( *it ) != sc( *it ) );
+  INBLOCK_TEST( nbDiff == 0 && i.size() == si.size() && d.size() == sd.size()
+                && c.size() == sc.size() && c.isValid() );
+  std::vector<Point> vc;
+  std::back_insert_iterator< std::vector<Point> > ito( vc );
+  a.computeComplement( ito );
+  INBLOCK_TEST( vc.size() == c.size() && std::vector<Point>( c.begin(), c.end() ) == vc );
+
+  // sets of different domains are combined point by point.
+  Domain small( Point( 0, 3, -2 ), Point( 4, 6, 0 ) );
+  BitSet e( small );
+  e.insert( Point( 0, 3, -2 ) );
+  e.insert( Point( 4, 6, 0 ) );
+  BitSet f( a );
+  f += e;
+  INBLOCK_TEST( f( Point( 0, 3, -2 ) ) && f( Point( 4, 6, 0 ) ) && f.isValid()
+                && f.size() == a.size() + ( a( Point( 0, 3, -2 ) ) ? 0 : 1 )
+                + ( a( Point( 4, 6, 0 ) ) ? 0 : 1 ) );
+  Point lower, upper;
+  e.computeBoundingBox( lower, upper );
+  INBLOCK_TEST( lower == Point( 0, 3, -2 ) && upper == Point( 4, 6, 0 ) );
+  f.erase( f.begin(), f.end() );
+  INBLOCK_TEST( f.empty() && f.begin() == f.end() && f.isValid() );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 bool testDigitalSetConcept()
 {
   
@@ -383,6 +471,11 @@ int main()
     ( DigitalSetBySTLSet<Domain>(domain), DigitalSetBySTLSet<Domain>(domain) );
   trace.endBlock();
 
+  trace.beginBlock( "DigitalSetByBitGrid" );
+  bool okBitGrid = testDigitalSet< DigitalSetByBitGrid<Domain> >
+    ( DigitalSetByBitGrid<Domain>(domain), DigitalSetByBitGrid<Domain>(domain) );
+  trace.endBlock();
+
   trace.beginBlock( "DigitalSetFromMap" );
   typedef ImageContainerBySTLMap<Domain,short int> Map;
   Map map(domain); Map map2(domain);        //maps
@@ -405,11 +498,13 @@ int main()
 
   bool okDigitalSetDomain = testDigitalSetDomain();
 
+  bool okDigitalSetByBitGrid = testDigitalSetByBitGrid();
+
   bool okDigitalSetDraw = testDigitalSetDraw();
 
   bool okDigitalSetDrawSnippet = testDigitalSetBoardSnippet();
 
-  bool res = okVector && okSet && okMap
+  bool res = okVector && okSet && okBitGrid && okMap && okDigitalSetByBitGrid
       && okSelectorSmall && okSelectorBig && okSelectorMediumHBel
   && okDigitalSetDomain && okDigitalSetDraw ;  trace.endBlock();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -0,0 +1,251 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testConnectedComponentLabelling.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class ConnectedComponentLabelling against the
+ * components of Object computed by breadth-first traversals.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/kernel/sets/DigitalSetByBitGrid.h"
+#include "DGtal/topology/Object.h"
+#include "DGtal/topology/ConnectedComponentLabelling.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ConnectedComponentLabelling.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compares the labelling of a random set, for several numbers of
+ * slabs, with the components of an Object with an STL set (which are
+ * not in the same order, the points of an STL set being sorted by
+ * their first coordinate).
+ */
+template <typename TDigitalTopology>
+bool testRandomSet( const TDigitalTopology & topo,
+                    const typename TDigitalTopology::Point & upper,
+                    unsigned int density )
+{
+  typedef typename TDigitalTopology::Point Point;
+  typedef typename TDigitalTopology::ForegroundAdjacency::Space Space;
+  typedef HyperRectDomain<Space> Domain;
+  typedef DigitalSetBySTLSet<Domain> STLSet;
+  typedef DigitalSetByBitGrid<Domain> BitSet;
+  typedef Object<TDigitalTopology, STLSet> STLObject;
+  typedef Object<TDigitalTopology, BitSet> BitObject;
+  typedef ConnectedComponentLabelling<Domain> Labelling;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  Domain domain( Point::diagonal( 0 ), upper );
+  STLSet stlSet( domain );
+  BitSet bitSet( domain );
+  for ( typename Domain::ConstIterator it = domain.begin(),
+          itEnd = domain.end(); it != itEnd; ++it )
+    if ( (unsigned int) ( random() % 100 ) < density )
+      {
+        stlSet.insertNew( *it );
+        bitSet.insertNew( *it );
+      }
+
+  std::vector<STLObject> objects;
+  std::back_insert_iterator< std::vector<STLObject> > ito( objects );
+  STLObject( topo, stlSet ).writeComponents( ito );
+  trace.info() << "set of " << stlSet.size() << " points, "
+               << objects.size() << " components" << std::endl;
+
+  // objectOf[ l ] is the object of the component of label l.
+  std::vector<unsigned int> objectOf;
+  for ( unsigned int nbThreads = 1; nbThreads <= 5; ++nbThreads )
+    {
+      Labelling labelling( domain );
+      bool ok = labelling.compute( topo.kappa(), stlSet, nbThreads )
+        == objects.size();
+      // each object has exactly the points of one label.
+      std::vector<unsigned int> objectOfLabel( objects.size() + 1, 0 );
+      for ( unsigned int i = 0; ok && i < objects.size(); ++i )
+        {
+          typename Labelling::Label l
+            = labelling.label( *objects[ i ].pointSet().begin() );
+          ok = ( l != 0 ) && ( objectOfLabel[ l ] == 0 )
+            && ( labelling.size( l ) == objects[ i ].size() );
+          objectOfLabel[ l ] = i;
+          for ( typename STLSet::ConstIterator it = objects[ i ].pointSet().begin(),
+                  itEnd = objects[ i ].pointSet().end(); ok && it != itEnd; ++it )
+            ok = labelling.label( *it ) == l;
+        }
+      ok = ok && ( labelling.size( 0 ) == domain.size() - stlSet.size() );
+      // the labels do not depend on the number of slabs.
+      if ( objectOf.empty() ) objectOf = objectOfLabel;
+      ok = ok && ( objectOf == objectOfLabel );
+      // the bits are read directly.
+      ok = ok && ( labelling.compute( topo.kappa(), bitSet, nbThreads )
+                   == objects.size() );
+      for ( unsigned int i = 1; ok && i <= objects.size(); ++i )
+        ok = labelling.label( *objects[ objectOf[ i ] ].pointSet().begin() ) == i;
+      nbok += ok ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << nbThreads << " slabs: " << labelling << std::endl;
+    }
+
+  // conversion to sets and objects.
+  Labelling labelling( domain );
+  labelling.compute( topo.kappa(), bitSet, 3 );
+  std::vector<BitSet> sets;
+  std::back_insert_iterator< std::vector<BitSet> > its( sets );
+  labelling.template writeSets<BitSet>( its );
+  bool ok = sets.size() == objects.size();
+  for ( unsigned int i = 0; ok && i < sets.size(); ++i )
+    {
+      const STLObject & object = objects[ objectOf[ i + 1 ] ];
+      ok = ( sets[ i ].size() == object.size() ) && sets[ i ].isValid();
+      for ( typename BitSet::ConstIterator it = sets[ i ].begin(),
+              itEnd = sets[ i ].end(); ok && it != itEnd; ++it )
+        ok = object.pointSet().find( *it ) != object.pointSet().end();
+    }
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") writeSets" << std::endl;
+
+  // Object uses the labelling for a grid of bits.
+  std::vector<BitObject> bitObjects;
+  std::back_insert_iterator< std::vector<BitObject> > itb( bitObjects );
+  BitObject bitObject( topo, bitSet );
+  ok = ( bitObject.writeComponents( itb ) == objects.size() )
+    && ( bitObjects.size() == objects.size() )
+    && ( bitObject.computeConnectedness()
+         == ( objects.size() == 1 ? CONNECTED : DISCONNECTED ) );
+  for ( unsigned int i = 0; ok && i < bitObjects.size(); ++i )
+    ok = ( bitObjects[ i ].connectedness() == CONNECTED )
+      && ( bitObjects[ i ].pointSet().size() == sets[ i ].size() )
+      && std::equal( bitObjects[ i ].pointSet().begin(),
+                     bitObjects[ i ].pointSet().end(), sets[ i ].begin() );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") Object::writeComponents"
+               << std::endl;
+  return nbok == nb;
+}
+
+bool testConnectedComponentLabelling()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  srandom( 0 );
+
+  trace.beginBlock ( "Labelling in 2D, (4,8) and (8,4) topologies" );
+  nbok += testRandomSet( Z2i::dt4_8, Z2i::Point( 40, 30 ), 50 ) ? 1 : 0;
+  nb++;
+  nbok += testRandomSet( Z2i::dt8_4, Z2i::Point( 40, 30 ), 40 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Labelling in 3D, 6, 18 and 26 adjacencies" );
+  nbok += testRandomSet( Z3i::dt6_18, Z3i::Point( 12, 10, 9 ), 40 ) ? 1 : 0;
+  nb++;
+  nbok += testRandomSet( Z3i::dt18_6, Z3i::Point( 12, 10, 9 ), 20 ) ? 1 : 0;
+  nb++;
+  nbok += testRandomSet( Z3i::dt26_6, Z3i::Point( 12, 10, 9 ), 15 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Empty and full sets" );
+  Z3i::Domain domain( Z3i::Point( -2, -2, -2 ), Z3i::Point( 3, 3, 3 ) );
+  Z3i::DigitalSet set( domain );
+  ConnectedComponentLabelling<Z3i::Domain> labelling( domain );
+  nbok += ( labelling.compute( Z3i::adj6, set, 4 ) == 0 ) ? 1 : 0;
+  nb++;
+  set.assignFromComplement( Z3i::DigitalSet( domain ) );
+  nbok += ( ( labelling.compute( Z3i::adj6, set, 4 ) == 1 )
+            && ( labelling.size( 1 ) == domain.size() )
+            && ( labelling.label( Z3i::Point( 3, -2, 0 ) ) == 1 )
+            && ( labelling.label( Z3i::Point( 4, 0, 0 ) ) == 0 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Sparse sets and large domains" );
+  // a sparse set is traversed, its components are on their bounding boxes.
+  typedef DigitalSetByBitGrid<Z2i::Domain> BitSet;
+  typedef Object<Z2i::DT4_8, BitSet> BitObject;
+  Z2i::Domain sparseDomain( Z2i::Point( 0, 0 ), Z2i::Point( 999, 999 ) );
+  BitSet sparseSet( sparseDomain );
+  sparseSet.insertNew( Z2i::Point( 10, 20 ) );
+  sparseSet.insertNew( Z2i::Point( 11, 20 ) );
+  sparseSet.insertNew( Z2i::Point( 11, 21 ) );
+  sparseSet.insertNew( Z2i::Point( 500, 900 ) );
+  std::vector<BitObject> bitObjects;
+  std::back_insert_iterator< std::vector<BitObject> > itb( bitObjects );
+  nbok += ( ( BitObject( Z2i::dt4_8, sparseSet ).writeComponents( itb ) == 2 )
+            && ( bitObjects[ 0 ].size() == 3 )
+            && ( bitObjects[ 0 ].pointSet().domain().lowerBound()
+                 == Z2i::Point( 10, 20 ) )
+            && ( bitObjects[ 0 ].pointSet().domain().upperBound()
+                 == Z2i::Point( 11, 21 ) )
+            && ( bitObjects[ 1 ].pointSet().domain().size() == 1 ) ) ? 1 : 0;
+  nb++;
+  // 2^32 points cannot be labelled with 32 bits.
+  nbok += ( ConnectedComponentLabelling<Z2i::Domain>::isLabellable
+            ( Z2i::Domain( Z2i::Point( 0, 0 ), Z2i::Point( 65535, 65534 ) ) )
+            && ! ConnectedComponentLabelling<Z2i::Domain>::isLabellable
+            ( Z2i::Domain( Z2i::Point( 0, 0 ), Z2i::Point( 65535, 65535 ) ) ) )
+    ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ConnectedComponentLabelling" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testConnectedComponentLabelling();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
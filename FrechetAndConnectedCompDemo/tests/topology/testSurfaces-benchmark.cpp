@@ -0,0 +1,132 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSurfaces-benchmark.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Benchmark of Surfaces::extractAll2DSCellContours (raster scan and
+ * bit grid) versus the extraction from a std::set of the boundary
+ * surfels, on a 4096x4096 image or on a given PGM image.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <set>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
+#include "DGtal/io/readers/PNMReader.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z2i;
+
+typedef ImageContainerBySTLVector<Domain, unsigned char> Image;
+typedef IntervalThresholder<Image::Value> Binarizer;
+typedef PointFunctorPredicate<Image,Binarizer> Predicate;
+
+/**
+ * The extraction based on a std::set of the boundary surfels.
+ */
+void
+extractWithSet( std::vector< std::vector<SCell> > & contours,
+                const KSpace & K, const SurfelAdjacency<2> & sAdj,
+                const Predicate & pp )
+{
+  std::set<SCell> bdry;
+  Surfaces<KSpace>::sMakeBoundary( bdry, K, pp, K.lowerBound(), K.upperBound() );
+  contours.clear();
+  while( ! bdry.empty() )
+    {
+      std::vector<SCell> aContour;
+      Surfaces<KSpace>::track2DBoundary( aContour, K, sAdj, pp, *(bdry.begin()) );
+      contours.push_back( aContour );
+      for( unsigned int i = 0; i < aContour.size(); i++ )
+        bdry.erase( aContour[ i ] );
+    }
+}
+
+/**
+ * Fills the image with noisy disks.
+ */
+void
+makeImage( Image & image )
+{
+  const Domain & d = image.domain();
+  int w = d.upperBound()[ 0 ] - d.lowerBound()[ 0 ] + 1;
+  int h = d.upperBound()[ 1 ] - d.lowerBound()[ 1 ] + 1;
+  srand( 0 );
+  for ( Domain::ConstIterator it = d.begin(); it != d.end(); ++it )
+    {
+      int x = ( (*it)[ 0 ] % 64 ) - 32;
+      int y = ( (*it)[ 1 ] % 64 ) - 32;
+      int r = 18 + ( ( (*it)[ 0 ] / 64 + (*it)[ 1 ] / 64 ) % 10 );
+      bool in = ( x*x + y*y <= r*r );
+      if ( rand() % 50 == 0 ) in = ! in;
+      image.setValue( *it, in ? 255 : 0 );
+    }
+  trace.info() << "Synthetic image " << w << "x" << h << std::endl;
+}
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmark of Surfaces::extractAll2DSCellContours" );
+  Image image( Domain( Point( 0, 0 ), Point( 4095, 4095 ) ) );
+  if ( argc > 1 )
+    image = PNMReader<Image>::importPGM( argv[ 1 ] );
+  else
+    makeImage( image );
+  KSpace K;
+  K.init( image.domain().lowerBound(), image.domain().upperBound(), true );
+  Binarizer b( 128, 255 );
+  Predicate pp( image, b );
+
+  bool ok = true;
+  for ( unsigned int interior = 0; interior < 2; ++interior )
+    {
+      SurfelAdjacency<2> sAdj( interior == 1 );
+      std::vector< std::vector<SCell> > c1, c2;
+      trace.beginBlock( interior == 1 ? "Interior adjacency" : "Exterior adjacency" );
+      Clock c;
+      c.startClock();
+      extractWithSet( c1, K, sAdj, pp );
+      double t1 = c.stopClock();
+      c.startClock();
+      Surfaces<KSpace>::extractAll2DSCellContours( c2, K, sAdj, pp );
+      double t2 = c.stopClock();
+      trace.info() << c2.size() << " contours" << std::endl;
+      trace.info() << "std::set: " << t1 << " ms, raster scan: " << t2 << " ms" << std::endl;
+      ok = ok && ( c1 == c2 );
+      trace.endBlock();
+    }
+  trace.emphase() << ( ok ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return ok ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,328 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSurfaces.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing Surfaces::extractAll2DSCellContours against
+ * the extraction from a std::set of the boundary surfels,
+ * Surfaces::extractAll2DSCellContoursByLevels, and
+ * Surfaces::extractAllConnectedSCell against the same extraction with
+ * Surfaces::trackBoundary.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <set>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z2i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing Surfaces::extractAll2DSCellContours.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * A random binary image seen as a point predicate.
+ */
+struct RandomShape {
+  typedef Z2i::Point Point;
+  RandomShape( const Point & low, const Point & up, double density )
+    : myLow( low ), myWidth( up[ 0 ] - low[ 0 ] + 1 ),
+      myBits( myWidth * ( up[ 1 ] - low[ 1 ] + 1 ) )
+  {
+    for ( unsigned int i = 0; i < myBits.size(); ++i )
+      myBits[ i ] = ( rand() < density * RAND_MAX );
+  }
+  bool operator()( const Point & p ) const
+  {
+    return myBits[ ( p[ 1 ] - myLow[ 1 ] ) * myWidth + ( p[ 0 ] - myLow[ 0 ] ) ];
+  }
+  Point myLow;
+  int myWidth;
+  std::vector<bool> myBits;
+};
+
+/**
+ * The extraction based on a std::set of the boundary surfels.
+ */
+template <typename PointPredicate>
+void
+extractWithSet( std::vector< std::vector<SCell> > & contours,
+                const KSpace & K, const SurfelAdjacency<2> & sAdj,
+                const PointPredicate & pp )
+{
+  std::set<SCell> bdry;
+  Surfaces<KSpace>::sMakeBoundary( bdry, K, pp, K.lowerBound(), K.upperBound() );
+  contours.clear();
+  while( ! bdry.empty() )
+    {
+      std::vector<SCell> aContour;
+      Surfaces<KSpace>::track2DBoundary( aContour, K, sAdj, pp, *(bdry.begin()) );
+      contours.push_back( aContour );
+      for( unsigned int i = 0; i < aContour.size(); i++ )
+        bdry.erase( aContour[ i ] );
+    }
+}
+
+bool testExtractAll2DSCellContours()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing extractAll2DSCellContours on random shapes" );
+  srand( 0 );
+  for ( unsigned int n = 0; n < 40; ++n )
+    {
+      Point low( rand() % 21 - 10, rand() % 21 - 10 );
+      Point up = low + Point( 1 + rand() % 40, 1 + rand() % 40 );
+      KSpace K;
+      K.init( low, up, true );
+      RandomShape shape( low, up, ( rand() % 9 + 1 ) / 10.0 );
+      for ( unsigned int interior = 0; interior < 2; ++interior )
+        {
+          SurfelAdjacency<2> sAdj( interior == 1 );
+          std::vector< std::vector<SCell> > c1, c2;
+          extractWithSet( c1, K, sAdj, shape );
+          Surfaces<KSpace>::extractAll2DSCellContours( c2, K, sAdj, shape );
+          nb++, nbok += ( c1 == c2 ) ? 1 : 0;
+        }
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same contours in the same order" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * A random image of levels, and its shape of a given level.
+ */
+struct RandomLevels {
+  typedef Z2i::Point Point;
+  RandomLevels( const Point & low, const Point & up, unsigned int nbValues )
+    : myLow( low ), myWidth( up[ 0 ] - low[ 0 ] + 1 ),
+      myLevels( myWidth * ( up[ 1 ] - low[ 1 ] + 1 ) )
+  {
+    for ( unsigned int i = 0; i < myLevels.size(); ++i )
+      myLevels[ i ] = rand() % nbValues;
+  }
+  unsigned int operator()( const Point & p ) const
+  {
+    return myLevels[ ( p[ 1 ] - myLow[ 1 ] ) * myWidth + ( p[ 0 ] - myLow[ 0 ] ) ];
+  }
+  Point myLow;
+  int myWidth;
+  std::vector<unsigned int> myLevels;
+};
+
+struct LevelShape {
+  typedef Z2i::Point Point;
+  LevelShape( const RandomLevels & levels, unsigned int level )
+    : myLevels( &levels ), myLevel( level ) {}
+  bool operator()( const Point & p ) const
+  {
+    return (*myLevels)( p ) <= myLevel;
+  }
+  const RandomLevels* myLevels;
+  unsigned int myLevel;
+};
+
+bool testExtractAll2DSCellContoursByLevels()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing extractAll2DSCellContoursByLevels on random images" );
+  srand( 1 );
+  for ( unsigned int n = 0; n < 20; ++n )
+    {
+      Point low( rand() % 21 - 10, rand() % 21 - 10 );
+      Point up = low + Point( 1 + rand() % 40, 1 + rand() % 40 );
+      KSpace K;
+      K.init( low, up, true );
+      unsigned int nbLevels = 1 + rand() % 8;
+      // some points are in none of the shapes.
+      RandomLevels levels( low, up, nbLevels + 2 );
+      for ( unsigned int interior = 0; interior < 2; ++interior )
+        {
+          SurfelAdjacency<2> sAdj( interior == 1 );
+          std::vector< std::vector< std::vector<SCell> > > c;
+          Surfaces<KSpace>::extractAll2DSCellContoursByLevels( c, K, sAdj, levels, nbLevels );
+          nb++, nbok += ( c.size() == nbLevels ) ? 1 : 0;
+          for ( unsigned int i = 0; ( i < nbLevels ) && ( i < c.size() ); ++i )
+            {
+              std::vector< std::vector<SCell> > c1;
+              Surfaces<KSpace>::extractAll2DSCellContours( c1, K, sAdj,
+                                                           LevelShape( levels, i ) );
+              nb++, nbok += ( c1 == c[ i ] ) ? 1 : 0;
+            }
+        }
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same contours as extractAll2DSCellContours at each level" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testExtractAllPointContours4C()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing extractAllPointContours4C on a square with a hole" );
+  Point low( 0, 0 );
+  Point up( 9, 9 );
+  KSpace K;
+  K.init( low, up, true );
+  Domain domain( Point( 2, 2 ), Point( 7, 7 ) );
+  DigitalSet set( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( ( *it != Point( 4, 4 ) ) && ( *it != Point( 5, 4 ) ) )
+      set.insertNew( *it );
+  for ( unsigned int interior = 0; interior < 2; ++interior )
+    {
+      std::vector< std::vector<Point> > contours;
+      Surfaces<KSpace>::extractAllPointContours4C( contours, K, set,
+                                                  SurfelAdjacency<2>( interior == 1 ) );
+      trace.info() << contours.size() << " contours of sizes";
+      for ( unsigned int i = 0; i < contours.size(); ++i )
+        trace.info() << " " << contours[ i ].size();
+      trace.info() << std::endl;
+      nb++, nbok += ( contours.size() == 2 ) ? 1 : 0;
+      nb++, nbok += ( contours.size() == 2 ) && ( contours[ 0 ].size() == 25 )
+        && ( contours[ 1 ].size() == 7 ) ? 1 : 0;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "two closed contours of 24 and 6 surfels" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing Surfaces::extractAllConnectedSCell.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The extraction of the components of the boundary by successive
+ * trackBoundary from the lowest surfel not yet tracked.
+ */
+template <typename TKSpace, typename PointPredicate>
+void
+trackAllWithSet( std::vector< std::vector<typename TKSpace::SCell> > & components,
+                 const TKSpace & K,
+                 const SurfelAdjacency<TKSpace::dimension> & sAdj,
+                 const PointPredicate & pp, bool orient )
+{
+  typedef typename TKSpace::SCell SCell;
+  std::set<SCell> bdry;
+  Surfaces<TKSpace>::sMakeBoundary( bdry, K, pp, K.lowerBound(), K.upperBound() );
+  components.clear();
+  while( ! bdry.empty() )
+    {
+      std::set<SCell> aComponent;
+      Surfaces<TKSpace>::trackBoundary( aComponent, K, sAdj, pp, *(bdry.begin()) );
+      std::vector<SCell> v( aComponent.begin(), aComponent.end() );
+      for( unsigned int i = 0; i < v.size(); i++ )
+        bdry.erase( v[ i ] );
+      if ( orient )
+        Surfaces<TKSpace>::orientSCellExterior( v, K, pp );
+      components.push_back( v );
+    }
+}
+
+/**
+ * Compares extractAllConnectedSCell on random sets of a domain of
+ * upper bound [up] with trackAllWithSet.
+ */
+template <typename TKSpace>
+bool testExtractAllConnectedSCellOnRandomSets( const typename TKSpace::Point & up,
+                                               unsigned int nbSets )
+{
+  typedef typename TKSpace::Point Point;
+  typedef typename TKSpace::SCell SCell;
+  typedef HyperRectDomain<typename TKSpace::Space> Domain;
+  typedef DigitalSetBySTLSet<Domain> DigitalSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  for ( unsigned int n = 0; n < nbSets; ++n )
+    {
+      Point low = Point::diagonal( rand() % 11 - 5 );
+      TKSpace K;
+      K.init( low, low + up, true );
+      Domain domain( low, low + up );
+      DigitalSet set( domain );
+      double density = ( rand() % 9 + 1 ) / 10.0;
+      for ( typename Domain::ConstIterator it = domain.begin(),
+              itEnd = domain.end(); it != itEnd; ++it )
+        if ( rand() < density * RAND_MAX )
+          set.insertNew( *it );
+      for ( unsigned int interior = 0; interior < 2; ++interior )
+        for ( unsigned int orient = 0; orient < 2; ++orient )
+          {
+            SurfelAdjacency<TKSpace::dimension> sAdj( interior == 1 );
+            std::vector< std::vector<SCell> > c1, c2;
+            trackAllWithSet( c1, K, sAdj, set, orient == 1 );
+            Surfaces<TKSpace>::extractAllConnectedSCell( c2, K, sAdj, set,
+                                                         orient == 1 );
+            nb++, nbok += ( c1 == c2 ) ? 1 : 0;
+          }
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same components in the same order" << std::endl;
+  return nbok == nb;
+}
+
+bool testExtractAllConnectedSCell()
+{
+  trace.beginBlock ( "Testing extractAllConnectedSCell on random sets" );
+  srand( 2 );
+  bool res = testExtractAllConnectedSCellOnRandomSets<Z2i::KSpace>( Z2i::Point( 30, 20 ), 10 )
+    && testExtractAllConnectedSCellOnRandomSets<Z3i::KSpace>( Z3i::Point( 9, 7, 12 ), 10 );
+  trace.endBlock();
+  return res;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing Surfaces::extractAll2DSCellContours" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testExtractAll2DSCellContours()
+    && testExtractAll2DSCellContoursByLevels()
+    && testExtractAllPointContours4C()
+    && testExtractAllConnectedSCell();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
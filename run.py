@@ -95,7 +95,8 @@ command_args = ['frechetSimplification'] + \
                 ['-imageSize', str(inputWidth), str(inputHeight)] + \
                 ['-error', str(args.e), '-sdp',
                 'inputPolygon.txt' ]+\
-                ['-allContours']
+                ['-allContours'] + \
+                ['-raster', 'output.png', '-resolution', '120']
 
 with open("algoLog.txt", "a") as f:
     if w:
@@ -122,13 +123,6 @@ with open("tmp.dat", "w") as contoursList, open("output.txt", "r") as f:
 shutil.copy('tmp.dat','outputPolygon.txt')
 
 
-## ---------
-## process 4: converting to output result
-## ---------
-command_args = ['gs', '-q', '-dNOCACHE', '-dEPSCrop', '-dNOPAUSE', '-dBATCH', '-dSAFER', '-sDEVICE=png16m', '-r120',  '-sOutputFile=output.png', 'output.eps']
-runCommand(command_args)
-
-
 ## ----
 ## Final step: save command line
 ## ----